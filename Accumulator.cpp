@@ -0,0 +1,138 @@
+// ==========================================
+// File:    Accumulator.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <cstring>
+using namespace std;
+
+#include "Accumulator.hpp"
+#include "Settings.hpp"
+
+// Constructor: Default
+// ====================
+// The stack has room for one Accumulator per ply of the Search.
+AccumulatorStack::AccumulatorStack()
+    : network(nullptr), entries(MAX_PLY + 2), top(0) {
+    this->reset();
+}
+
+// Public Method: setNetwork
+// =========================
+// Sets the Network whose feature transformer is accumulated.
+void AccumulatorStack::setNetwork(const Network* network) {
+    this->network = network;
+    this->reset();
+}
+
+// Public Method: reset
+// ====================
+// Empties the stack, leaving a single Accumulator for the root
+// Position which will be computed when it is first evaluated.
+void AccumulatorStack::reset() {
+    this->top = 0;
+    this->entries[0].isComputed[White] = false;
+    this->entries[0].isComputed[Black] = false;
+}
+
+// Public Method: push
+// ===================
+// Records a move that has just been played on the Position.
+void AccumulatorStack::push(Move move, Piece moved, Piece captured) {
+    Accumulator& next = this->entries[++this->top];
+    next.isComputed[White] = false;
+    next.isComputed[Black] = false;
+    next.moved = moved;
+    next.captured = captured;
+    next.from = static_cast<unsigned char>(move.getFrom());
+    next.to = static_cast<unsigned char>(move.getTo());
+}
+
+// Public Method: pop
+// ==================
+// Drops the Accumulator of the move that has just been taken back.
+void AccumulatorStack::pop() {
+    --this->top;
+}
+
+// Private Method: refresh
+// =======================
+// Computes one perspective of the current Accumulator from
+// all of the pieces in the given Position.
+void AccumulatorStack::refresh(const Position& position, Color perspective) {
+    int16_t* values = this->entries[this->top].values[perspective];
+    memcpy(values, this->network->getFeatureBiases(),
+           sizeof(int16_t) * NETWORK_HIDDEN);
+
+    int kingSquare = position.getKingSquare(perspective);
+    Bitboard pieces = position.getPieces() & ~position.getPieces(KingType);
+    while (pieces) {
+        int square = popLsb(pieces);
+        int feature = Network::featureIndex(perspective, kingSquare,
+                                            position.pieceOn(square), square);
+        Network::addWeights(values, this->network->getFeatureWeights(feature));
+    }
+    this->entries[this->top].isComputed[perspective] = true;
+}
+
+// Private Method: update
+// ======================
+// Brings one perspective of the current Accumulator up to date. It looks
+// down the stack for a computed Accumulator and, if no move of this
+// side's King was made since, replays the moves above it one at a time.
+void AccumulatorStack::update(const Position& position, Color perspective) {
+    Piece king = makePiece(perspective, KingType);
+    int start = this->top;
+    while (!this->entries[start].isComputed[perspective]) {
+        if (start == 0 || this->entries[start].moved == king) {
+            this->refresh(position, perspective);
+            return;
+        }
+        --start;
+    }
+
+    // The King has not moved since, so its square is the current one.
+    int kingSquare = position.getKingSquare(perspective);
+    for (int i = start + 1; i <= this->top; ++i) {
+        const Accumulator& previous = this->entries[i - 1];
+        Accumulator& current = this->entries[i];
+        int16_t* values = current.values[perspective];
+        memcpy(values, previous.values[perspective],
+               sizeof(int16_t) * NETWORK_HIDDEN);
+
+        // Kings are not features, so a move of the other side's King
+        // only matters for what it captured.
+        if (typeOf(current.moved) != KingType) {
+            int from = Network::featureIndex(perspective, kingSquare,
+                                             current.moved, current.from);
+            int to = Network::featureIndex(perspective, kingSquare,
+                                           current.moved, current.to);
+            Network::subtractWeights(values,
+                                     this->network->getFeatureWeights(from));
+            Network::addWeights(values, this->network->getFeatureWeights(to));
+        }
+        if (current.captured != NO_PIECE) {
+            int captured = Network::featureIndex(perspective, kingSquare,
+                                                 current.captured,
+                                                 current.to);
+            Network::subtractWeights(values,
+                                     this->network->getFeatureWeights(
+                                                                 captured));
+        }
+        current.isComputed[perspective] = true;
+    }
+}
+
+// Public Method: evaluate
+// =======================
+// Takes the current Position, brings its Accumulator up to date and
+// returns the Network's score for it from the side to move's view.
+int AccumulatorStack::evaluate(const Position& position) {
+    Accumulator& current = this->entries[this->top];
+    if (!current.isComputed[White]) this->update(position, White);
+    if (!current.isComputed[Black]) this->update(position, Black);
+    Color us = position.getSideToMove();
+    return this->network->propagate(current.values[us],
+                                    current.values[flip(us)]);
+}
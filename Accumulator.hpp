@@ -0,0 +1,98 @@
+// ==========================================
+// File:    Accumulator.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef ACCUMULATOR_HPP
+#define ACCUMULATOR_HPP
+
+#include <cstdint>
+#include <vector>
+using namespace std;
+
+#include "Network.hpp"
+#include "Position.hpp"
+#include "Move.hpp"
+
+// Struct: Accumulator
+// ===================
+// Holds the output of the feature transformer of a Network for both
+// sides of a Position, along with the move that led to that Position,
+// so that it can be computed from the Accumulator before it.
+struct Accumulator {
+    int16_t values[2][NETWORK_HIDDEN];  // One per perspective.
+    bool isComputed[2];                 // Whether values are up to date.
+    Piece moved;                        // Piece moved to get here.
+    Piece captured;                     // Piece captured, if any.
+    unsigned char from;                 // Source square of the move.
+    unsigned char to;                   // Destination square of the move.
+};
+
+// Class: AccumulatorStack
+// =======================
+// This class keeps one Accumulator per ply of the Search. Playing a
+// move only records it on the stack and taking it back just pops it,
+// so moves that are never evaluated cost next to nothing. When a
+// Position is evaluated, its Accumulator is brought up to date from
+// the nearest computed Accumulator below it by adding and subtracting
+// the weights of the few features each move changes. The features of
+// a side depend on where its King stands, so after a move of that
+// King its half of the Accumulator is refreshed from scratch instead.
+class AccumulatorStack {
+
+    private:
+
+        const Network* network;         // Network providing the weights.
+        vector<Accumulator> entries;    // One per ply, the root first.
+        int top;                        // Index of the current ply.
+
+        // Method: refresh
+        // ===============
+        // Computes one perspective of the current Accumulator from
+        // all of the pieces in the given Position.
+        void refresh(const Position& position, Color perspective);
+
+        // Method: update
+        // ==============
+        // Brings one perspective of the current Accumulator up to date,
+        // either incrementally or, after a King move, with a refresh.
+        void update(const Position& position, Color perspective);
+
+    public:
+
+        // Constructor: Default
+        // ====================
+        AccumulatorStack();
+
+        // Method: setNetwork
+        // ==================
+        // Sets the Network whose feature transformer is accumulated.
+        void setNetwork(const Network* network);
+
+        // Method: reset
+        // =============
+        // Empties the stack, leaving a single Accumulator for the root
+        // Position which will be computed when it is first evaluated.
+        void reset();
+
+        // Method: push
+        // ============
+        // Records a move that has just been played on the Position.
+        // Takes the moved Piece and the Piece it captured, if any.
+        void push(Move move, Piece moved, Piece captured);
+
+        // Method: pop
+        // ===========
+        // Drops the Accumulator of the move that has just been taken back.
+        void pop();
+
+        // Method: evaluate
+        // ================
+        // Takes the current Position, brings its Accumulator up to date
+        // and returns the Network's score for it from the point of view
+        // of the side to move.
+        int evaluate(const Position& position);
+};
+
+#endif
@@ -12,14 +12,15 @@ using namespace std;
 
 // Constructor: Default
 // ====================
-Bishop::Bishop() : ChessPiece() {}
+Bishop::Bishop() : ChessPiece() {
+    this->type = BishopType;
+}
 
 // Constructor:
 // ============
 // This constructor takes a Color and creates a Bishop of that Color.
 Bishop::Bishop(Color color) : ChessPiece(color) {
-    this->name = BISHOP_NAME;
-    this->initSymbol(color);
+    this->type = BishopType;
 }
 
 // Constructor:
@@ -28,22 +29,13 @@ Bishop::Bishop(Color color) : ChessPiece(color) {
 // constructs a Bishop of that Color, setting its square
 // property to point to the given ChessSquare.
 Bishop::Bishop(Color c, const ChessSquare& cs) : ChessPiece(c, cs) {
-    this->name = BISHOP_NAME;
-    this->initSymbol(c);
+    this->type = BishopType;
 }
 
 // Destructor:
 // ===========
 Bishop::~Bishop() {}
 
-// Private Method: initSymbol
-// ==========================
-// This method initialises the symbol
-// property of the Bishop given its Color.
-void Bishop::initSymbol(Color color) {
-    this->symbol = (color == White) ? WHITE_BISHOP : BLACK_BISHOP;
-}
-
 // Public Method: isPossibleMove
 // =============================
 // This method takes a ChessSquare and a pointer to the ChessPiece
@@ -80,7 +72,7 @@ pair<bool, bool> Bishop::isPossibleMove(ChessSquare& square,
 // Friend Operator: <<
 // ===================
 // Outputs the symbol property of the Bishop operand.
-ostream& operator<<(ostream& os, Bishop bishop) {
-    os << bishop.symbol;
+ostream& operator<<(ostream& os, const Bishop& bishop) {
+    os << bishop.getSymbol();
     return os;
 }
@@ -18,14 +18,6 @@ using namespace std;
 // is a subclass of ChessPiece. This class defines how a Bishop can move,
 // its name and the symbol it is given according to its Color.
 class Bishop : public ChessPiece {
-    
-    private:
-
-        // Method: initSymbol
-        // ==================
-        // This method initialises the symbol
-        // property of the Bishop given its Color.
-        void initSymbol(Color color);
 
     public:
 
@@ -56,7 +48,7 @@ class Bishop : public ChessPiece {
         // Operator: <<
         // ============
         // Outputs the symbol property of the Bishop operand.
-        friend ostream& operator<<(ostream& os, Bishop bishop);
+        friend ostream& operator<<(ostream& os, const Bishop& bishop);
 };
 
 #endif
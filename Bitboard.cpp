@@ -0,0 +1,111 @@
+// ==========================================
+// File:    Bitboard.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include "Bitboard.hpp"
+#include "ChessPiece.hpp"
+
+// Lookup Tables
+// =============
+Bitboard KNIGHT_ATTACKS[NUM_SQUARES];
+Bitboard KING_ATTACKS[NUM_SQUARES];
+Bitboard PAWN_ATTACKS[2][NUM_SQUARES];
+Bitboard RAYS[8][NUM_SQUARES];
+Bitboard BETWEEN[NUM_SQUARES][NUM_SQUARES];
+Bitboard ADJACENT_FILES[NUM_SQUARES];
+Bitboard FORWARD_FILE[2][NUM_SQUARES];
+Bitboard PASSED_PAWN_MASKS[2][NUM_SQUARES];
+
+// Function: offsetBit
+// ===================
+// Takes the index of a square and a file and rank offset, and returns
+// a Bitboard with the resulting square set, or an empty Bitboard if
+// the offset would take the square off the board.
+static Bitboard offsetBit(int square, int fileOffset, int rankOffset) {
+    int file = square % SIDE_LEN + fileOffset;
+    int rank = square / SIDE_LEN + rankOffset;
+    if (file < 0 || file >= SIDE_LEN || rank < 0 || rank >= SIDE_LEN) {
+        return EMPTY_BITBOARD;
+    }
+    return squareBit(rank * SIDE_LEN + file);
+}
+
+// Function: initBitboards
+// =======================
+// Fills in all of the lookup tables declared in Bitboard.hpp.
+static void initBitboards() {
+
+    // File and rank offsets for each Direction, in the
+    // same order as they are declared in the enum.
+    const int rayOffsets[8][2] = {{0, 1}, {1, 0}, {1, 1}, {-1, 1},
+                                  {0, -1}, {-1, 0}, {1, -1}, {-1, -1}};
+    const int knightOffsets[8][2] = {{1, 2}, {2, 1}, {2, -1}, {1, -2},
+                                     {-1, -2}, {-2, -1}, {-2, 1}, {-1, 2}};
+
+    for (int square = 0; square < NUM_SQUARES; ++square) {
+
+        // Knights and Kings hop to a fixed set of squares.
+        KNIGHT_ATTACKS[square] = EMPTY_BITBOARD;
+        KING_ATTACKS[square] = EMPTY_BITBOARD;
+        for (int i = 0; i < 8; ++i) {
+            KNIGHT_ATTACKS[square] |= offsetBit(square, knightOffsets[i][0],
+                                                knightOffsets[i][1]);
+            KING_ATTACKS[square] |= offsetBit(square, rayOffsets[i][0],
+                                              rayOffsets[i][1]);
+        }
+
+        // Pawns attack one step diagonally towards the opponent.
+        PAWN_ATTACKS[White][square] = offsetBit(square, -1, 1) |
+                                      offsetBit(square, 1, 1);
+        PAWN_ATTACKS[Black][square] = offsetBit(square, -1, -1) |
+                                      offsetBit(square, 1, -1);
+
+        // Walk each ray until it leaves the board, recording the squares
+        // between the origin and every square met along the way.
+        for (int i = 0; i < NUM_SQUARES; ++i) {
+            BETWEEN[square][i] = EMPTY_BITBOARD;
+        }
+        for (int direction = 0; direction < 8; ++direction) {
+            Bitboard ray = EMPTY_BITBOARD;
+            int step = 1;
+            Bitboard next;
+            while ((next = offsetBit(square, step * rayOffsets[direction][0],
+                                     step * rayOffsets[direction][1]))) {
+                BETWEEN[square][lsb(next)] = ray;
+                ray |= next;
+                ++step;
+            }
+            RAYS[direction][square] = ray;
+        }
+    }
+
+    // The pawn structure masks are built from the rays along the files.
+    for (int square = 0; square < NUM_SQUARES; ++square) {
+        int file = square % SIDE_LEN;
+        ADJACENT_FILES[square] = EMPTY_BITBOARD;
+        if (file > 0) ADJACENT_FILES[square] |= FILE_A_BITBOARD << (file - 1);
+        if (file < SIDE_LEN - 1) {
+            ADJACENT_FILES[square] |= FILE_A_BITBOARD << (file + 1);
+        }
+        FORWARD_FILE[White][square] = RAYS[North][square];
+        FORWARD_FILE[Black][square] = RAYS[South][square];
+        for (int color = White; color <= Black; ++color) {
+            Bitboard ahead = FORWARD_FILE[color][square];
+            PASSED_PAWN_MASKS[color][square] =
+                ahead | ((ahead << 1) & ~FILE_A_BITBOARD) |
+                        ((ahead >> 1) & ~FILE_H_BITBOARD);
+        }
+    }
+}
+
+// Struct: BitboardInitialiser
+// ===========================
+// A single static instance of this struct fills in
+// the lookup tables before main is entered.
+static struct BitboardInitialiser {
+    BitboardInitialiser() {
+        initBitboards();
+    }
+} bitboardInitialiser;
@@ -0,0 +1,246 @@
+// ==========================================
+// File:    Bitboard.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef BITBOARD_HPP
+#define BITBOARD_HPP
+
+#include <cstdint>
+#include <string>
+using namespace std;
+
+#include "Settings.hpp"
+
+// Type: Bitboard
+// ==============
+// A Bitboard is a 64-bit set of squares, one bit per square. Squares
+// are indexed from 0 (A1) to 63 (H8), going left to right along each
+// rank and then up the board, so that bit (rank - 1) * 8 + file is set
+// when the square at that file and rank belongs to the set.
+typedef uint64_t Bitboard;
+
+// Constants: Bitboards
+// ====================
+const int NO_SQUARE = NUM_SQUARES;
+const Bitboard EMPTY_BITBOARD = 0ULL;
+const Bitboard FILE_A_BITBOARD = 0x0101010101010101ULL;
+const Bitboard FILE_H_BITBOARD = FILE_A_BITBOARD << (SIDE_LEN - 1);
+const Bitboard RANK_1_BITBOARD = 0xFFULL;
+const Bitboard RANK_3_BITBOARD = RANK_1_BITBOARD << (2 * SIDE_LEN);
+const Bitboard RANK_6_BITBOARD = RANK_1_BITBOARD << (5 * SIDE_LEN);
+const Bitboard LIGHT_SQUARES = 0x55AA55AA55AA55AAULL;
+
+// Function: squareIndex
+// =====================
+// Takes a file (e.g. 'A') and a rank (e.g. 1) and
+// returns the index of that square on a Bitboard.
+inline int squareIndex(char file, int rank) {
+    return (rank - BOTTOM_RANK) * SIDE_LEN + (file - LEFTMOST_FILE);
+}
+
+// Function: squareFile
+// ====================
+// Takes the index of a square and returns its file.
+inline char squareFile(int square) {
+    return static_cast<char>(LEFTMOST_FILE + (square % SIDE_LEN));
+}
+
+// Function: squareRank
+// ====================
+// Takes the index of a square and returns its rank.
+inline int squareRank(int square) {
+    return BOTTOM_RANK + (square / SIDE_LEN);
+}
+
+// Function: squareBit
+// ===================
+// Takes the index of a square and returns a
+// Bitboard in which only that square is set.
+inline Bitboard squareBit(int square) {
+    return 1ULL << square;
+}
+
+// Function: popCount
+// ==================
+// Returns the number of squares set in the given Bitboard.
+inline int popCount(Bitboard b) {
+    return __builtin_popcountll(b);
+}
+
+// Function: lsb
+// =============
+// Returns the index of the lowest square set in a non-empty Bitboard.
+inline int lsb(Bitboard b) {
+    return __builtin_ctzll(b);
+}
+
+// Function: msb
+// =============
+// Returns the index of the highest square set in a non-empty Bitboard.
+inline int msb(Bitboard b) {
+    return 63 ^ __builtin_clzll(b);
+}
+
+// Function: popLsb
+// ================
+// Removes the lowest square from a non-empty
+// Bitboard and returns the index of that square.
+inline int popLsb(Bitboard& b) {
+    int square = lsb(b);
+    b &= b - 1;
+    return square;
+}
+
+// Class: SquareRange
+// ==================
+// A view over the squares set in a Bitboard, lowest first, which lets
+// them be walked with a range-based for loop. It holds nothing but the
+// Bitboard itself, so it is as cheap to make and copy as a Bitboard.
+class SquareRange {
+
+    private:
+
+        Bitboard squares;   // Squares in the range.
+
+    public:
+
+        // Class: Iterator
+        // ===============
+        // Walks the squares of a SquareRange, dereferencing to the index
+        // of the current square and dropping it when incremented.
+        class Iterator {
+
+            private:
+
+                Bitboard remaining;     // Squares not yet walked.
+
+            public:
+
+                explicit Iterator(Bitboard remaining) noexcept
+                    : remaining(remaining) {}
+
+                int operator*() const noexcept {
+                    return lsb(this->remaining);
+                }
+
+                Iterator& operator++() noexcept {
+                    this->remaining &= this->remaining - 1;
+                    return *this;
+                }
+
+                bool operator==(const Iterator& other) const noexcept {
+                    return this->remaining == other.remaining;
+                }
+
+                bool operator!=(const Iterator& other) const noexcept {
+                    return this->remaining != other.remaining;
+                }
+        };
+
+        // Constructor:
+        // ============
+        // Takes the Bitboard of the squares in the range.
+        explicit SquareRange(Bitboard squares) noexcept
+            : squares(squares) {}
+
+        Iterator begin() const noexcept { return Iterator(this->squares); }
+        Iterator end() const noexcept { return Iterator(0); }
+
+        // Method: size
+        // ============
+        // Returns the number of squares in the range.
+        int size() const noexcept { return popCount(this->squares); }
+
+        // Method: empty
+        // =============
+        // Returns true if there is no square in the range.
+        bool empty() const noexcept { return this->squares == 0; }
+};
+
+// Lookup Tables
+// =============
+// These tables are filled in once when the program starts. They hold
+// the squares attacked by the pieces whose attacks do not depend on
+// the rest of the board, the rays used to compute sliding attacks
+// and the squares strictly between any two aligned squares.
+extern Bitboard KNIGHT_ATTACKS[NUM_SQUARES];
+extern Bitboard KING_ATTACKS[NUM_SQUARES];
+extern Bitboard PAWN_ATTACKS[2][NUM_SQUARES];
+extern Bitboard RAYS[8][NUM_SQUARES];
+extern Bitboard BETWEEN[NUM_SQUARES][NUM_SQUARES];
+
+// Lookup Tables: Pawn Structure
+// =============================
+// For each square, the whole files on either side of it, the squares
+// ahead of it on its file as seen by each Color, and the squares ahead
+// of it on its own and the adjacent files. A Pawn with no enemy Pawn
+// in its PASSED_PAWN_MASKS is a passed Pawn.
+extern Bitboard ADJACENT_FILES[NUM_SQUARES];
+extern Bitboard FORWARD_FILE[2][NUM_SQUARES];
+extern Bitboard PASSED_PAWN_MASKS[2][NUM_SQUARES];
+
+// Enum: Direction
+// ===============
+// Indexes the RAYS table. The first four directions increase
+// the square index as they move away from the origin square
+// and the last four decrease it.
+enum Direction {North, East, NorthEast, NorthWest,
+                South, West, SouthEast, SouthWest};
+
+// Function: positiveRayAttacks
+// ============================
+// Returns the squares attacked along a ray of increasing square indices,
+// stopping at (and including) the first occupied square on the ray.
+inline Bitboard positiveRayAttacks(int square, Bitboard occupied,
+                                   Direction direction) {
+    Bitboard attacks = RAYS[direction][square];
+    Bitboard blockers = attacks & occupied;
+    if (blockers) attacks ^= RAYS[direction][lsb(blockers)];
+    return attacks;
+}
+
+// Function: negativeRayAttacks
+// ============================
+// Returns the squares attacked along a ray of decreasing square indices,
+// stopping at (and including) the first occupied square on the ray.
+inline Bitboard negativeRayAttacks(int square, Bitboard occupied,
+                                   Direction direction) {
+    Bitboard attacks = RAYS[direction][square];
+    Bitboard blockers = attacks & occupied;
+    if (blockers) attacks ^= RAYS[direction][msb(blockers)];
+    return attacks;
+}
+
+// Function: bishopAttacks
+// =======================
+// Returns the squares attacked by a Bishop on the
+// given square given the occupied squares of a board.
+inline Bitboard bishopAttacks(int square, Bitboard occupied) {
+    return positiveRayAttacks(square, occupied, NorthEast) |
+           positiveRayAttacks(square, occupied, NorthWest) |
+           negativeRayAttacks(square, occupied, SouthEast) |
+           negativeRayAttacks(square, occupied, SouthWest);
+}
+
+// Function: rookAttacks
+// =====================
+// Returns the squares attacked by a Rook on the
+// given square given the occupied squares of a board.
+inline Bitboard rookAttacks(int square, Bitboard occupied) {
+    return positiveRayAttacks(square, occupied, North) |
+           positiveRayAttacks(square, occupied, East) |
+           negativeRayAttacks(square, occupied, South) |
+           negativeRayAttacks(square, occupied, West);
+}
+
+// Function: queenAttacks
+// ======================
+// Returns the squares attacked by a Queen on the
+// given square given the occupied squares of a board.
+inline Bitboard queenAttacks(int square, Bitboard occupied) {
+    return bishopAttacks(square, occupied) | rookAttacks(square, occupied);
+}
+
+#endif
@@ -0,0 +1,22 @@
+// ==========================================
+// File:    BoardSnapshot.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+using namespace std;
+
+#include "BoardSnapshot.hpp"
+
+// Public Method: capture
+// ======================
+// Copies the Pieces and the side to move of the given Position, and
+// whether it is in check. The rest is left for the caller to fill in.
+void BoardSnapshot::capture(const Position& position) {
+    for (int square = 0; square < NUM_SQUARES; square += 2) {
+        this->squares[square / 2] = static_cast<uint8_t>(
+            position.pieceOn(square) | (position.pieceOn(square + 1) << 4));
+    }
+    this->sideToMove = position.getSideToMove();
+    this->isCheck = position.isInCheck(this->sideToMove);
+}
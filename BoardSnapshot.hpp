@@ -0,0 +1,46 @@
+// ==========================================
+// File:    BoardSnapshot.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef BOARD_SNAPSHOT_HPP
+#define BOARD_SNAPSHOT_HPP
+
+#include <cstdint>
+using namespace std;
+
+#include "Position.hpp"
+#include "Move.hpp"
+
+// Struct: BoardSnapshot
+// =====================
+// A compact copy of the state of a game as shown to spectators. The
+// Pieces are packed two per byte, the square with the lower index in
+// the low half, so that the whole snapshot fits in well under a cache
+// line and can be copied around freely, e.g. through a SeqLock.
+struct BoardSnapshot {
+    uint8_t squares[NUM_SQUARES / 2];   // Piece on each square.
+    uint64_t eventCount;                // MoveEvents published so far.
+    uint32_t plyCount;                  // Moves played so far.
+    Move lastMove;                      // Null before the first move.
+    Color sideToMove;                   // Color of the player to move.
+    bool isCheck;                       // Whether it is in check.
+    bool isGameOver;                    // Whether the game has ended.
+
+    // Method: capture
+    // ===============
+    // Copies the Pieces and the side to move of the given Position,
+    // and whether it is in check.
+    void capture(const Position& position);
+
+    // Method: pieceOn
+    // ===============
+    // Returns the Piece on the square with the given index.
+    Piece pieceOn(int square) const {
+        return static_cast<Piece>((this->squares[square / 2] >>
+                                   (4 * (square & 1))) & 0xF);
+    }
+};
+
+#endif
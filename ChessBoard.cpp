@@ -10,13 +10,46 @@ using namespace std;
 
 #include "Settings.hpp"
 #include "ChessBoard.hpp"
+#include "MoveGenerator.hpp"
 
 // Constructor: Default
 // ====================
 // This default constructor calls methods that initialise the ChessBoard
 // object's properties, arrange the pieces on the board and start the
 // game so that it is ready to receive moves.
-ChessBoard::ChessBoard() {
+ChessBoard::ChessBoard()
+    : sink(&ConsoleSink::getInstance()), events(MOVE_EVENT_RING_SIZE),
+      speculator(nullptr), replies(nullptr) {
+    this->init();
+    this->arrange();
+    this->startGame();
+}
+
+// Constructor:
+// ============
+// Takes a bool indicating whether the ChessBoard should keep quiet, i.e.
+// not notify the client about the game, e.g. when it is driven by a
+// program rather than played on the console. Otherwise it behaves
+// just like the default constructor.
+ChessBoard::ChessBoard(bool isQuiet)
+    : events(MOVE_EVENT_RING_SIZE), speculator(nullptr), replies(nullptr) {
+    if (isQuiet) {
+        this->sink = &NullSink::getInstance();
+    } else {
+        this->sink = &ConsoleSink::getInstance();
+    }
+    this->init();
+    this->arrange();
+    this->startGame();
+}
+
+// Constructor:
+// ============
+// Takes the NotificationSink to notify about the game. Otherwise
+// it behaves just like the default constructor.
+ChessBoard::ChessBoard(NotificationSink& sink)
+    : sink(&sink), events(MOVE_EVENT_RING_SIZE), speculator(nullptr),
+      replies(nullptr) {
     this->init();
     this->arrange();
     this->startGame();
@@ -29,6 +62,11 @@ ChessBoard::~ChessBoard() {
     // If this ChessBoard has a ChessSet, delete it before destructing.
     if (this->pieces != nullptr) delete this->pieces;
     this->pieces = nullptr;
+
+    // Make sure the Speculator is done with the ReplyTable first.
+    this->setSpeculator(nullptr);
+    delete this->replies;
+    this->replies = nullptr;
 }
 
 // Private Method: init
@@ -53,10 +91,12 @@ void ChessBoard::init() {
                 pair<ChessSquare, ChessPiece*> position(square, nullptr);
                 this->board.insert(position);
             } catch (InvalidCoordinatesException& e) {
-                cerr << "ERROR! Caught InvalidCoordinatesException "
-                     << "when calling ChessSquare constructor with "
-                     << "file=" << file << " and rank=" << rank << " "
-                     << "in ChessBoard::init." << endl;
+                ostringstream message;
+                message << "ERROR! Caught InvalidCoordinatesException "
+                        << "when calling ChessSquare constructor with "
+                        << "file=" << file << " and rank=" << rank << " "
+                        << "in ChessBoard::init.";
+                this->sink->errorRaised(message.str());
             }
         }
     }
@@ -109,6 +149,25 @@ void ChessBoard::arrangeSide(Color color) {
     }
 }
 
+// Private Method: syncPosition
+// ============================
+// Rebuilds the position property from the Board, so that
+// the compact copy of the game matches the pieces in play.
+void ChessBoard::syncPosition() {
+    this->position.clear();
+    BoardConstIterator i = this->board.begin();
+    while (i != this->board.end()) {
+        ChessPiece* piece = i->second;
+        if (piece != nullptr) {
+            int square = squareIndex(i->first.getFile(), i->first.getRank());
+            this->position.addPiece(piece->getColor(), piece->getType(),
+                                    square);
+        }
+        ++i;
+    }
+    this->position.setSideToMove(this->turn);
+}
+
 // Private Method: startGame
 // =========================
 // This method ensures that the properties of the ChessBoard
@@ -125,8 +184,82 @@ void ChessBoard::startGame() {
     this->whiteKingSquare = this->getKingStartSquare(White);
     this->blackKingSquare = this->getKingStartSquare(Black);
 
+    // Build the compact copy of the Board used by the engine.
+    this->syncPosition();
+    this->termination.reset(this->position);
+    this->areDestinationsValid = false;
+    this->premoves[White].clear();
+    this->premoves[Black].clear();
+    this->premoveResultCount = 0;
+
+    // Start the history of the game from here.
+    this->history.reset(this->takeCheckpoint(), this->isGameOver);
+
+    // Let readers on other threads see the new game.
+    this->plyCount = 0;
+    this->publish();
+    this->speculate();
+
     // Notify client that a new game has started.
-    cout << "A new chess game is started!" << endl;
+    this->sink->gameStarted();
+}
+
+// Private Method: publish
+// ========================
+// Takes the MoveResult of the Move that has just been played, or a
+// nullptr if a game has just started, and publishes a MoveEvent and
+// then a BoardSnapshot, taken from the compact copy of the Board. The
+// snapshot records how many events were published up to it, so that
+// a watcher that resyncs from it knows which event comes next.
+void ChessBoard::publish(const MoveResult* result, bool isJump) {
+    chrono::steady_clock::time_point now = chrono::steady_clock::now();
+    if (result == nullptr && !isJump) this->startTime = now;
+
+    MoveEvent event;
+    event.key = this->position.getKey();
+    event.time = static_cast<uint32_t>(
+        chrono::duration_cast<chrono::milliseconds>(now -
+                                                    this->startTime).count());
+    event.plyCount = this->plyCount;
+    event.captured = NO_PIECE;
+    event.flags = 0;
+    if (isJump) {
+        event.flags = JUMP_FLAG;
+        if (result != nullptr) event.move = Move(result->from, result->to);
+    } else if (result == nullptr) {
+        event.flags = NEW_GAME_FLAG;
+    } else {
+        event.move = Move(result->from, result->to);
+        if (result->isCapture()) {
+            event.captured = makePiece(!result->color, result->captured);
+            event.flags |= CAPTURE_FLAG;
+        }
+        if (result->isCheck) event.flags |= CHECK_FLAG;
+        if (result->isCheckmate) event.flags |= CHECKMATE_FLAG;
+        if (result->isStalemate) event.flags |= STALEMATE_FLAG;
+        if (result->isDraw() && !result->isStalemate) {
+            event.flags |= DRAW_FLAG;
+        }
+    }
+    this->events.publish(event);
+
+    BoardSnapshot snapshot;
+    snapshot.capture(this->position);
+    snapshot.eventCount = this->events.getHead();
+    snapshot.plyCount = this->plyCount;
+    snapshot.lastMove = event.move;
+    snapshot.isGameOver = this->isGameOver;
+    this->snapshot.store(snapshot);
+}
+
+// Private Method: speculate
+// =========================
+// Asks the Speculator, if any, for the replies to the
+// current position, unless the game is over.
+void ChessBoard::speculate() {
+    if (this->speculator != nullptr && !this->isGameOver) {
+        this->speculator->request(*this->replies, this->position);
+    }
 }
 
 // Private Method: switchTurns
@@ -142,232 +275,208 @@ void ChessBoard::switchTurns() {
 // Takes a source string and a destination string, presumably
 // with chess coordinates of the form file followed by rank,
 // e.g. "A1", and persists it on the Board if the move is valid.
+// The client is notified of the result through the NotificationSink.
 void ChessBoard::submitMove(string source, string destination) {
 
     // Cannot submit moves if the game is over. Notify and return.
+    this->premoveResultCount = 0;
+    MoveResult result;
     if (this->isGameOver) {
-        cout << "Game is over. No more moves are allowed." << endl;
+        this->sink->moveSubmitted(result);
         return;
     }
 
-    // Get the location of the source ChessSquare on the Board,
-    // but make sure to catch the exception if the source parameter
-    // does not correspond to a valid square. If so, notify and return.
-    BoardIterator i;
+    // Get the source ChessSquare, but make sure to catch the exception
+    // if the source parameter does not correspond to a valid square.
+    // If so, notify and return.
+    ChessSquare sourceSquare;
     try {
-        ChessSquare square(source);
-        i = this->board.find(square);
+        sourceSquare = ChessSquare(source);
     } catch (InvalidCoordinatesException& e) {
-        cout << "ERROR! Caught InvalidCoordinatesException when calling "
-             << "ChessSquare constructor for source ChessSquare with "
-             << "input=" << source << " in ChessBoard::submitMove."
-             << endl;
+        this->sink->squareRejected(source, true);
         return;
     }
 
-    // If the source ChessSquare is valid but not on the board, then
-    // the Board might have been corrupted. Notify client and return.
-    if (i == this->board.end()) {
-        cout << "ERROR! Source ChessSquare is not on the board. It's "
-             << "possible that this ChessBoard has been corrupted."
-             << endl;
+    // Notify client and return if the source square is empty or holds
+    // a piece of the player whose turn it is not to play.
+    int square = squareIndex(sourceSquare.getFile(), sourceSquare.getRank());
+    if (!checkSource(this->position, square, result)) {
+        this->sink->moveSubmitted(result);
         return;
     }
 
-    // Get ChessSquare and ChessPiece at provided source.
-    // Notify client and return if the square is empty.
-    ChessSquare sourceSquare = i->first;
-    ChessPiece* sourcePiece = i->second;
-    if (i->second == nullptr) {
-        cout << "There is no piece at position "
-             << sourceSquare << "!" << endl;
-        return;
-    }
-
-    // If the piece in the source square is not of the same color as
-    // the player whose turn it is to play, notify client and return.
-    Color sourcePieceColor = sourcePiece->getColor();
-    if (sourcePieceColor != this->turn) {
-        cout << "It is not " << sourcePieceColor << "'s "
-             << "turn to move!" << endl;
-        return;
-    }
-
-    // Get the location of the destination ChessSquare on the Board,
-    // but make sure to catch the exception if the destination parameter
-    // does not correspond to a valid square. If so, notify and return.
-    BoardIterator j;
+    // Get the destination ChessSquare, but make sure to catch the
+    // exception if the destination parameter does not correspond
+    // to a valid square. If so, notify and return.
+    ChessSquare destinationSquare;
     try {
-        ChessSquare square(destination);
-        j = this->board.find(square);
+        destinationSquare = ChessSquare(destination);
     } catch (InvalidCoordinatesException& e) {
-        cout << "ERROR! Caught InvalidCoordinatesException when calling "
-             << "ChessSquare constructor for destination ChessSquare with "
-             << "input=" << destination << " in ChessBoard::submitMove."
-             << endl;
+        this->sink->squareRejected(destination, false);
         return;
     }
 
-    // If the destination ChessSquare is valid but not on the board,
-    // then the Board might have been corrupted. Notify and return.
-    if (j == this->board.end()) {
-        cout << "ERROR! Source ChessSquare is not on the board. It's "
-             << "possible that this ChessBoard has been corrupted."
-             << endl;
-        return;
-    }
+    // Play the move if it is valid and inform the client either way,
+    // before any move the opponent has queued is played.
+    result = this->commitMove(Move(square,
+                                   squareIndex(destinationSquare.getFile(),
+                                               destinationSquare.getRank())));
+    this->sink->moveSubmitted(result);
+    if (result.isPlayed()) this->playPremoves();
+}
 
-    // Get ChessSquare and ChessPiece at destination square. The
-    // second will be a nullptr if the destination square is empty.
-    ChessSquare destinationSquare = j->first;
-    ChessPiece* destinationPiece = j->second;
+// Public Method: submitMove
+// =========================
+// Takes source and destination ChessSquare objects and persists the
+// move on the Board if it is valid. The move is validated and played
+// on the compact copy of the Board, so this costs no more than a few
+// lookups and the check for mate, and nothing is formatted or printed.
+// Any move the opponent has queued is then played too.
+MoveResult ChessBoard::submitMove(const ChessSquare& source,
+                                  const ChessSquare& destination) {
+    Move move(squareIndex(source.getFile(), source.getRank()),
+              squareIndex(destination.getFile(), destination.getRank()));
+    return this->submitMove(move);
+}
 
-    // This stream will be used to inform the client of a valid move.
-    stringstream ssSuccess;
+// Public Method: submitMove
+// =========================
+// Takes a Move and persists it on the Board if it is valid, then
+// plays the moves queued by the opponent. Returns its MoveResult.
+MoveResult ChessBoard::submitMove(Move move) {
+    this->premoveResultCount = 0;
+    MoveResult result = this->commitMove(move);
+    if (result.isPlayed()) this->playPremoves();
+    return result;
+}
 
-    // Ensure the move is valid, else return.
-    if (!this->isValidMove(sourceSquare, destinationSquare, sourcePiece,
-                           destinationPiece, ssSuccess, false)) {
-        return;
+// Private Method: commitMove
+// ==========================
+// Takes a Move and plays it if it is valid in a game that is not over,
+// first on the compact copy of the Board, then on the Board itself.
+MoveResult ChessBoard::commitMove(Move move) {
+
+    // Cannot submit moves if the game is over.
+    MoveResult result;
+    if (this->isGameOver) return result;
+
+    // If its replies have been validated ahead of time, the move only
+    // needs to be looked up and played. Otherwise validate and play it
+    // on the compact copy of the Board.
+    const MoveResult* reply = nullptr;
+    if (this->speculator != nullptr) {
+        reply = this->replies->find(this->position.getKey(), move);
     }
-
-    // If the opponent is now in check or checkmate, or if the game has
-    // ended in stalemate, notify the client. If the game has ended, set
-    // the appropriate flags in order to prevent further moves.
-    if (this->isInCheck(!this->turn)) {
-
-        // Inform client that opponent is in check.
-        ssSuccess << endl << !this->turn << " is in check";
-
-        // If opponent is in check and can't move, it is checkmate.
-        if (!this->hasValidMove(!this->turn)) {
-            ssSuccess << "mate";
-            this->isGameOver = true;
-        }
-
+    if (reply != nullptr) {
+        result = *reply;
+        UndoInfo undo;
+        this->position.makeMove(move, undo);
     } else {
-
-        // If opponent isn't in check and can't move, it is stalemate.
-        if (!this->hasValidMove(!this->turn)) {
-            ssSuccess << endl << !this->turn << " cannot move. "
-                      << "Stalemate!" << endl;
-            this->isGameOver = true;
-        }
-
+        result = playMove(this->position, move,
+                          this->termination.getHintSquare(!this->turn));
+        if (!result.isPlayed()) return result;
+    }
+    this->termination.record(this->position, result);
+    this->areDestinationsValid = false;
+
+    // Persist the move on the Board too, and record it in the history.
+    ChessSquare sourceSquare(squareFile(move.getFrom()),
+                             squareRank(move.getFrom()));
+    ChessSquare destinationSquare(squareFile(move.getTo()),
+                                  squareRank(move.getTo()));
+    HistoryEntry entry;
+    entry.result = result;
+    entry.moved = this->board[sourceSquare];
+    entry.captured = this->board[destinationSquare];
+    entry.halfmoveClock = this->termination.getHalfmoveClock();
+    this->update(entry.moved, entry.captured, sourceSquare,
+                 destinationSquare);
+    this->history.record(entry, this->position.getKey());
+
+    // If the game has ended, set isGameOver in order to prevent further
+    // moves and drop any queued ones. Otherwise signal that it's the
+    // other player's turn now.
+    if (result.isGameOver()) {
+        this->isGameOver = true;
+        this->premoves[White].clear();
+        this->premoves[Black].clear();
+    } else {
+        this->switchTurns();
     }
 
-    // Inform the client about a successful move.
-    cout << ssSuccess.str() << endl;
-
-    // Signal that it's the other player's turn now if the game goes on.
-    if (!this->isGameOver) this->switchTurns();
+    // Let readers on other threads see the move.
+    if (this->history.isCheckpointDue()) {
+        this->history.addCheckpoint(this->takeCheckpoint());
+    }
+    ++this->plyCount;
+    this->publish(&result);
+    this->speculate();
 
+    return result;
 }
 
-// Private Method: hasValidMove
+// Private Method: playPremoves
 // ============================
-// Takes a Color and returns true if it can make a valid move.
-bool ChessBoard::hasValidMove(Color color) {
-
-    // Used to suppress output to client as this check is silent.
-    stringstream ss;
-
-    // Iterate through all of the pieces of the given
-    // color and check if any of them can move.
-    const ChessSide* side = this->pieces->getSide(color);
-    ChessSideConstIterator i = side->begin();
-    while (i != side->end()) {
-        ChessPiece* sourcePiece = *i;
-        ChessSquare* sourceSquarePtr = sourcePiece->getSquare();
-
-        // Do not consider pieces that have already been captured.
-        if (sourceSquarePtr != nullptr) {
-            ChessSquare sourceSquare = *sourceSquarePtr;
-            BoardIterator j = this->board.begin();
-            while (j != this->board.end()) {
-                ChessSquare destinationSquare = j->first;
-                ChessPiece* destinationPiece = j->second;
-                if (isValidMove(sourceSquare, destinationSquare,
-                                sourcePiece, destinationPiece, ss, true)){
-                    return true;
-                }
-                ++j;
-            }
+// Plays the moves queued by the player to move, if any. A queued move
+// is only checked once it is that player's turn, like any other move,
+// which costs a couple of lookups. Once one is played it is the
+// opponent's turn, who may have queued moves too. The MoveResult of
+// each is kept for clients that are not notified.
+void ChessBoard::playPremoves() {
+    while (!this->isGameOver && !this->premoves[this->turn].isEmpty()) {
+        Color color = this->turn;
+        MoveResult result = this->commitMove(this->premoves[color].pop());
+        this->premoveResults[this->premoveResultCount++] = result;
+        this->sink->moveSubmitted(result);
+        if (!result.isPlayed()) {
+            this->premoves[color].clear();
+            return;
         }
-        ++i;
     }
-    return false;
 }
 
-
-// Private Method: isValidMove
+// Public Method: queuePremove
 // ===========================
-// Takes source and destination ChessSquare objects, source and destination
-// ChessPiece pointers, a stringstream and a bool, and returns a bool
-// indicating if the move is valid. The stringstream is used to insert
-// messages that might be later on printed out to the client. If the
-// isQuiet argument is true, any errors are silenced. That is used when
-// playing out moves when checking for check, checkmate and stalemate.
-bool ChessBoard::isValidMove(ChessSquare sourceSquare,
-                             ChessSquare destinationSquare,
-                             ChessPiece* sourcePiece,
-                             ChessPiece* destinationPiece,
-                             stringstream& ssSuccess,
-                             bool isQuiet) {
-
-    string sourcePieceName = sourcePiece->getName();
-    Color sourcePieceColor = sourcePiece->getColor();
-
-    // This is the default error message for invalid moves caught.
-    stringstream ssErr;
-    ssErr << sourcePieceColor << "'s " << sourcePieceName
-          << " cannot move to " << destinationSquare << "!";
-
-    // Ensure that the move is possible before validating
-    // that it does not leave the King in check.
-    if (!this->isPossibleMove(sourceSquare, destinationSquare,
-                              sourcePiece, destinationPiece)) {
-        if (!isQuiet) cout << ssErr.str() << endl;
-        return false;
-    }
+// Takes a Color and source and destination ChessSquare objects and
+// queues the move to be played once it is that Color's turn. Returns
+// false if the game is over, it is that Color's turn or its queue is
+// full.
+bool ChessBoard::queuePremove(Color color, const ChessSquare& source,
+                              const ChessSquare& destination) {
+    if (this->isGameOver || color == this->turn) return false;
+    Move move(squareIndex(source.getFile(), source.getRank()),
+              squareIndex(destination.getFile(), destination.getRank()));
+    return this->premoves[color].push(move);
+}
 
-    // Prepare scenario before confirming that the move is
-    // fully valid, i.e. it does not leave the King in check.
-    // Also update KingSquare if applicable.
-    this->update(sourcePiece, destinationPiece,
-                 sourceSquare, destinationSquare);
+// Public Method: clearPremoves
+// ============================
+// Takes a Color and drops every move it has queued.
+void ChessBoard::clearPremoves(Color color) {
+    this->premoves[color].clear();
+}
 
-    // Add information to the success case stringstream.
-    if (!isQuiet) {
-        ssSuccess << sourcePieceColor << "'s "
-                  << sourcePieceName << " moves from "
-                  << sourceSquare << " to " << destinationSquare;
-    }
+// Public Method: getPremoveCount
+// ==============================
+// Takes a Color and returns the number of moves it has queued.
+int ChessBoard::getPremoveCount(Color color) const {
+    return this->premoves[color].getSize();
+}
 
-    // If the destination square contained a piece, add
-    // information about the capture to the stringstream.
-    if (destinationPiece != nullptr && !isQuiet) {
-        ssSuccess << " taking " << destinationPiece->getColor()
-                  << "'s " << destinationPiece->getName();
-    }
+// Public Method: getPremoveResultCount
+// ====================================
+// Returns the number of queued moves tried after the last move
+// submitted.
+int ChessBoard::getPremoveResultCount() const {
+    return this->premoveResultCount;
+}
 
-    // Ensure that the King is not left in check.
-    if (this->isInCheck(sourcePieceColor)) {
-        // Return pieces to their original positions.
-        this->reverse(sourcePiece, destinationPiece,
-                      sourceSquare, destinationSquare);
-        if (!isQuiet) {
-            cout << ssErr.str() << endl;
-        }
-        return false;
-    }
-    if (isQuiet) {
-        // Return pieces to their original positions.
-        this->reverse(sourcePiece, destinationPiece,
-                      sourceSquare, destinationSquare);
-    }
-    
-    return true;
+// Public Method: getPremoveResult
+// ===============================
+// Takes an index below getPremoveResultCount and returns the
+// MoveResult of that queued move.
+const MoveResult& ChessBoard::getPremoveResult(int index) const {
+    return this->premoveResults[index];
 }
 
 // Private Method: update
@@ -375,9 +484,7 @@ bool ChessBoard::isValidMove(ChessSquare sourceSquare,
 // This method takes source and destination ChessPiece pointers, and
 // source and destination ChessSquare objects by reference and updates
 // the state of the Board and the ChessPiece objects to reflect a move
-// of the ChessPiece at source to the destination ChessSquare. This
-// method is also used in conjunction with ChessBoard::revers, to play
-// out moves in order to check for check, checkmate and stalemate.
+// of the ChessPiece at source to the destination ChessSquare.
 void ChessBoard::update(ChessPiece* sourcePiece,
                         ChessPiece* destinationPiece,
                         ChessSquare& sourceSquare,
@@ -392,88 +499,6 @@ void ChessBoard::update(ChessPiece* sourcePiece,
     updateKingSquare(sourceSquare, destinationSquare);
 }
 
-// Private Method: reverse
-// =======================
-// Takes source and destination ChessPiece pointers, and source
-// and destination ChessSquare objects by reference and updates
-// the state of the Board and the pieces to reflect reversing a
-// move of the ChessPiece at source to the destination ChessSquare
-// back to its source ChessSquare. This method is used with
-// ChessBoard::update to check for check, checkmate and stalemate.
-void ChessBoard::reverse(ChessPiece* sourcePiece,
-                         ChessPiece* destinationPiece,
-                         ChessSquare& sourceSquare,
-                         ChessSquare& destinationSquare) {
-
-    this->board[sourceSquare] = sourcePiece;
-    this->board[destinationSquare] = destinationPiece;
-    sourcePiece->setSquare(sourceSquare);
-    if (destinationPiece != nullptr) {
-        destinationPiece->setSquare(destinationSquare);
-    }
-    updateKingSquare(destinationSquare, sourceSquare);
-}
-
-
-// Private Method: isPossibleMove
-// ==============================
-// This method takes a source and a destination ChessSquare object by
-// reference, and a source and a destination ChessPiece pointer, and
-// returns a bool indicating if the move is possible given the rules
-// of movement for the source piece and any possible obstructions.
-// Note that returning true does not mean that this move is valid, as
-// it does not ensure that the move does not leave its King in check.
-bool ChessBoard::isPossibleMove(ChessSquare& sourceSquare,
-                                ChessSquare& destinationSquare,
-                                ChessPiece* sourcePiece,
-                                ChessPiece* destinationPiece) const {
-
-    // Ensure that the move is possible given its rules of movement. If
-    // so the first bool in the response will be true. The second bool
-    // is true if the move is possible, but requires an extra check to
-    // make sure there is nothing blocking the path of the move.
-    pair<bool, bool> response;
-    response = sourcePiece->isPossibleMove(destinationSquare,
-                                           destinationPiece);
-    bool isPossibleMove = response.first;
-    bool isPossiblyObstructed = response.second;
-
-    // If the move is not possible for that piece, return false.
-    if (!isPossibleMove) {
-        return false;
-    }
-
-    // If the move is possibly obstructed, check for blocks.
-    if (isPossiblyObstructed) {
-        if (this->isObstructed(sourceSquare, destinationSquare)) {
-            return false;
-        } 
-    }
-
-    return true;
-}
-
-// Private Method: isObstructed
-// ============================
-// This method takes two ChessSquare objects by reference and return a
-// bool indicating if there are any pieces in the squares between them.
-bool ChessBoard::isObstructed(ChessSquare& source,
-                              ChessSquare& destination) const {
-
-    // For moves in straight lines spanning more than one square, ensure
-    // that there's no obstruction between the source and destination.
-    set<ChessSquare> squares = source.getSquaresBetween(destination);
-    set<ChessSquare>::iterator i = squares.begin();
-    while (i != squares.end()) {
-        BoardConstIterator j = this->board.find(*i);
-        if (j->second != nullptr) {
-            return true;
-        }
-        ++i;
-    }
-    return false;
-}
-
 // Private Method: updateKingSquare
 // ================================
 // This method takes two ChessSquare objects and if the first
@@ -489,34 +514,207 @@ void ChessBoard::updateKingSquare(ChessSquare& source,
     }
 }
 
-// Private Method: isInCheck
-// =========================
-// This method takes a Color and returns a bool indicating
-// whether or not the King of the given Color is in check.
-bool ChessBoard::isInCheck(Color color) const {
-
-    // Get this color's King's position.
-    ChessSquare kingSquare = this->getKingSquare(color);
-    BoardConstIterator i = this->board.find(kingSquare);
-    ChessPiece* king = i->second;
-
-    // Get all of the opponent's pieces that are still on the board,
-    // i.e. whose square property is not nullptr, and see if any of
-    // them can attack this player's King. If so return true.
-    const ChessSide* opponents = this->pieces->getSide(!color);
-    ChessSideConstIterator j = opponents->begin();
-    while (j != opponents->end()) {
-        ChessPiece* opponent = *j;
-        ChessSquare* opponentSquare = opponent->getSquare();
-        if (opponentSquare != nullptr &&
-            this->isPossibleMove(*opponentSquare, kingSquare,
-                                 opponent, king)) {
-            return true;
+// Private Method: takeCheckpoint
+// ==============================
+// Returns a HistoryCheckpoint of the Position and of the square
+// of each ChessPiece of the ChessSet.
+HistoryCheckpoint ChessBoard::takeCheckpoint() const {
+    HistoryCheckpoint checkpoint;
+    checkpoint.position = this->position;
+    for (int color = White; color <= Black; ++color) {
+        const ChessSide* side =
+            this->pieces->getSide(static_cast<Color>(color));
+        for (int k = 0; k < PIECES_PER_SIDE; ++k) {
+            ChessSquare* square = side->at(k)->getSquare();
+            checkpoint.squares[color][k] = static_cast<uint8_t>(
+                (square == nullptr) ? NO_SQUARE
+                                    : squareIndex(square->getFile(),
+                                                  square->getRank()));
+        }
+    }
+    return checkpoint;
+}
+
+// Private Method: restoreCheckpoint
+// =================================
+// Takes a HistoryCheckpoint and puts the Position back, then empties
+// the Board and places each ChessPiece back on its square.
+void ChessBoard::restoreCheckpoint(const HistoryCheckpoint& checkpoint) {
+    this->position = checkpoint.position;
+    this->cleanUp();
+    for (int color = White; color <= Black; ++color) {
+        const ChessSide* side =
+            this->pieces->getSide(static_cast<Color>(color));
+        for (int k = 0; k < PIECES_PER_SIDE; ++k) {
+            ChessPiece* piece = side->at(k);
+            int index = checkpoint.squares[color][k];
+            if (index == NO_SQUARE) {
+                piece->setSquare(nullptr);
+                continue;
+            }
+            ChessSquare square(squareFile(index), squareRank(index));
+            piece->setSquare(square);
+            this->board[square] = piece;
+            if (piece->getType() == KingType) {
+                if (color == White) {
+                    this->whiteKingSquare = square;
+                } else {
+                    this->blackKingSquare = square;
+                }
+            }
         }
-        ++j;
     }
+}
+
+// Private Method: stepForward
+// ===========================
+// Takes a ply and plays the move recorded at it again. It was validated
+// when it was first played, so it is simply made on the Position and
+// the ChessPiece objects it moved and captured are updated on the Board.
+void ChessBoard::stepForward(int ply) {
+    const HistoryEntry& entry = this->history.getEntry(ply);
+    const MoveResult& result = entry.result;
+    UndoInfo undo;
+    this->position.makeMove(Move(result.from, result.to), undo);
+    ChessSquare sourceSquare(squareFile(result.from),
+                             squareRank(result.from));
+    ChessSquare destinationSquare(squareFile(result.to),
+                                  squareRank(result.to));
+    this->update(entry.moved, entry.captured, sourceSquare,
+                 destinationSquare);
+}
+
+// Private Method: stepBack
+// ========================
+// Takes a ply and takes back the move recorded at it: the move is
+// unmade on the Position, and on the Board the ChessPiece it moved goes
+// back to its source square and the one it captured, if any, back to
+// its destination square.
+void ChessBoard::stepBack(int ply) {
+    const HistoryEntry& entry = this->history.getEntry(ply);
+    const MoveResult& result = entry.result;
+    UndoInfo undo;
+    undo.captured = result.isCapture()
+                    ? makePiece(!result.color, result.captured)
+                    : NO_PIECE;
+    this->position.unmakeMove(Move(result.from, result.to), undo);
+    ChessSquare sourceSquare(squareFile(result.from),
+                             squareRank(result.from));
+    ChessSquare destinationSquare(squareFile(result.to),
+                                  squareRank(result.to));
+    this->board[sourceSquare] = entry.moved;
+    this->board[destinationSquare] = entry.captured;
+    entry.moved->setSquare(sourceSquare);
+    if (entry.captured != nullptr) {
+        entry.captured->setSquare(destinationSquare);
+    }
+    this->updateKingSquare(destinationSquare, sourceSquare);
+}
+
+// Private Method: finishJump
+// ==========================
+// Takes the ply the Position and the Board have been taken to and sets
+// the turn, whether the game is over and the state of the draw rules
+// as they were at that ply, drops any queued moves and publishes it.
+// As after any move, the turn stays with the player who ended the game.
+void ChessBoard::finishJump(int ply) {
+    this->history.setPly(ply);
+    this->isGameOver = this->history.isGameOverAt(ply);
+    this->turn = this->position.getSideToMove();
+    const MoveResult* last = nullptr;
+    int lastMoved[2] = {NO_SQUARE, NO_SQUARE};
+    int halfmoveClock = 0;
+    if (ply > 0) {
+        last = &this->history.getEntry(ply - 1).result;
+        if (this->isGameOver) this->turn = last->color;
+        lastMoved[last->color] = last->to;
+        halfmoveClock = this->history.getEntry(ply - 1).halfmoveClock;
+    }
+    if (ply > 1) {
+        const MoveResult& previous = this->history.getEntry(ply - 2).result;
+        lastMoved[previous.color] = previous.to;
+    }
+    this->termination.restore(this->history.getKeys() + ply - halfmoveClock,
+                              halfmoveClock, lastMoved[White],
+                              lastMoved[Black]);
+    this->areDestinationsValid = false;
+    this->premoves[White].clear();
+    this->premoves[Black].clear();
+    this->plyCount = ply;
+    this->publish(last, true);
+    this->speculate();
+}
 
-    return false;
+// Public Method: takeBack
+// =======================
+// Takes back the last move played with a single unmake.
+// Returns false if no move has been played.
+bool ChessBoard::takeBack() {
+    int ply = this->history.getPly();
+    return ply > 0 && this->gotoPly(ply - 1);
+}
+
+// Public Method: redoMove
+// =======================
+// Plays the last move taken back again. Returns false if there is none.
+bool ChessBoard::redoMove() {
+    return this->gotoPly(this->history.getPly() + 1);
+}
+
+// Public Method: gotoPly
+// ======================
+// Takes a ply and takes the game to that point of its history. If it is
+// closer to the latest checkpoint at or before it than to the current
+// ply, the checkpoint is restored first. A single step is always taken
+// from the current ply, so that a takeback is one unmake. Either way,
+// the moves in between are then taken back or played again.
+bool ChessBoard::gotoPly(int ply) {
+    if (ply < 0 || ply > this->history.getLength()) return false;
+    int current = this->history.getPly();
+    int distance = (ply > current) ? ply - current : current - ply;
+    int offset = ply % HISTORY_CHECKPOINT_PLIES;
+    if (distance > 1 && distance > offset) {
+        this->restoreCheckpoint(this->history.getCheckpoint(ply));
+        current = ply - offset;
+    }
+    while (current > ply) this->stepBack(--current);
+    while (current < ply) this->stepForward(current++);
+    this->finishJump(ply);
+    return true;
+}
+
+// Public Method: getPly
+// =====================
+// Returns the number of moves played to reach the current position.
+int ChessBoard::getPly() const {
+    return this->history.getPly();
+}
+
+// Public Method: getHistoryLength
+// ===============================
+// Returns the number of moves recorded in the history of the game.
+int ChessBoard::getHistoryLength() const {
+    return this->history.getLength();
+}
+
+// Public Method: setSink
+// =======================
+// Takes the NotificationSink to notify about the game from now on.
+void ChessBoard::setSink(NotificationSink& sink) {
+    this->sink = &sink;
+}
+
+// Public Method: setSpeculator
+// =============================
+// Takes a Speculator to validate the replies to each move ahead of
+// time, or a nullptr. The previous one, if any, is first made to drop
+// the ReplyTable, which is allocated the first time one is set.
+void ChessBoard::setSpeculator(Speculator* speculator) {
+    if (this->speculator != nullptr) this->speculator->cancel(*this->replies);
+    this->speculator = speculator;
+    if (speculator == nullptr) return;
+    if (this->replies == nullptr) this->replies = new ReplyTable();
+    this->speculate();
 }
 
 // Public Method: resetBoard
@@ -534,6 +732,143 @@ void ChessBoard::resetBoard() {
     this->startGame();
 }
 
+// Public Method: setPosition
+// ==========================
+// Takes a position in Forsyth-Edwards Notation (FEN) and sets up the
+// Board accordingly, returning false and leaving the Board untouched if
+// the FEN cannot be read. Only the placement of the pieces and the side
+// to move are used, as there is no castling or en passant capture. Each
+// piece in the FEN is matched with an unused ChessPiece of the same
+// type and Color from a fresh ChessSet, and the pieces left unused are
+// treated as captured, so the FEN cannot have more pieces of a type
+// than a ChessSet holds, and must have exactly one King per side. A FEN
+// with a Pawn on the first or last rank, or with the side not to move
+// in check, is not a position that can arise and is also rejected.
+bool ChessBoard::setPosition(const string& fen) {
+    stringstream ss(fen);
+    string placement;
+    string side;
+    ss >> placement >> side;
+    if (side != "w" && side != "b") return false;
+
+    // Read the pieces into a grid, rank 8 first, without touching
+    // the Board until the whole placement is known to be valid.
+    const string letters = "pnbrqk";
+    int grid[SIDE_LEN][SIDE_LEN];
+    int counts[2][NoPieceType] = {{0}};
+    int rank = TOP_RANK;
+    int file = 0;
+    for (size_t k = 0; k < placement.size(); ++k) {
+        char c = placement[k];
+        if (c == '/') {
+            if (file != SIDE_LEN || rank == BOTTOM_RANK) return false;
+            --rank;
+            file = 0;
+        } else if (c >= '1' && c <= '8') {
+            for (int n = 0; n < c - '0'; ++n) {
+                if (file >= SIDE_LEN) return false;
+                grid[rank - BOTTOM_RANK][file++] = -1;
+            }
+        } else {
+            size_t type = letters.find(static_cast<char>(tolower(c)));
+            if (type == string::npos || file >= SIDE_LEN) return false;
+            Color color = isupper(c) ? White : Black;
+            if (type == PawnType &&
+                (rank == BOTTOM_RANK || rank == TOP_RANK)) return false;
+            ++counts[color][type];
+            grid[rank - BOTTOM_RANK][file++] = makePiece(color,
+                                           static_cast<PieceType>(type));
+        }
+    }
+    if (rank != BOTTOM_RANK || file != SIDE_LEN) return false;
+
+    // Make sure a ChessSet holds enough pieces of each type.
+    ChessSet* chessSet = new ChessSet();
+    for (int color = White; color <= Black; ++color) {
+        int available[NoPieceType] = {0};
+        const ChessSide* pieces = chessSet->getSide(static_cast<Color>(color));
+        for (size_t k = 0; k < pieces->size(); ++k) {
+            ++available[pieces->at(k)->getType()];
+        }
+        for (int type = PawnType; type < NoPieceType; ++type) {
+            if (counts[color][type] > available[type]) {
+                delete chessSet;
+                return false;
+            }
+        }
+        if (counts[color][KingType] != 1) {
+            delete chessSet;
+            return false;
+        }
+    }
+
+    // The side that has just moved cannot have left its King in check.
+    Color turn = (side == "w") ? White : Black;
+    Position placed;
+    placed.clear();
+    for (int r = 0; r < SIDE_LEN; ++r) {
+        for (int f = 0; f < SIDE_LEN; ++f) {
+            int piece = grid[r][f];
+            if (piece < 0) continue;
+            placed.addPiece(colorOf(piece), typeOf(piece), r * SIDE_LEN + f);
+        }
+    }
+    placed.setSideToMove(turn);
+    if (placed.isInCheck(!turn)) {
+        delete chessSet;
+        return false;
+    }
+
+    // Place each piece on its square and capture the rest.
+    delete this->pieces;
+    this->pieces = chessSet;
+    this->cleanUp();
+    for (int color = White; color <= Black; ++color) {
+        const ChessSide* pieces = chessSet->getSide(static_cast<Color>(color));
+        bool isUsed[PIECES_PER_SIDE] = {false};
+        for (int r = 0; r < SIDE_LEN; ++r) {
+            for (int f = 0; f < SIDE_LEN; ++f) {
+                int piece = grid[r][f];
+                if (piece < 0 || colorOf(piece) != color) continue;
+                size_t k = 0;
+                while (isUsed[k] ||
+                       pieces->at(k)->getType() != typeOf(piece)) {
+                    ++k;
+                }
+                isUsed[k] = true;
+                ChessSquare square(LEFTMOST_FILE + f, BOTTOM_RANK + r);
+                pieces->at(k)->setSquare(square);
+                this->board[square] = pieces->at(k);
+                if (typeOf(piece) == KingType) {
+                    if (color == White) {
+                        this->whiteKingSquare = square;
+                    } else {
+                        this->blackKingSquare = square;
+                    }
+                }
+            }
+        }
+        for (size_t k = 0; k < pieces->size(); ++k) {
+            if (!isUsed[k]) pieces->at(k)->setSquare(nullptr);
+        }
+    }
+
+    this->turn = turn;
+    this->syncPosition();
+    this->termination.reset(this->position);
+    this->areDestinationsValid = false;
+    this->premoves[White].clear();
+    this->premoves[Black].clear();
+    this->premoveResultCount = 0;
+    this->isGameOver = !hasLegalMove(this->position);
+    this->history.reset(this->takeCheckpoint(), this->isGameOver);
+    this->plyCount = 0;
+    this->publish();
+    this->speculate();
+    this->sink->gameStarted();
+    return true;
+}
+
 // Public Method: getBoard
 // =======================
 // This method returns the board property of the ChessBoard.
@@ -541,6 +876,134 @@ Board ChessBoard::getBoard() const {
     return this->board;
 }
 
+// Public Method: pieceAt
+// ======================
+// Takes a ChessSquare and returns the ChessPiece on it,
+// or a nullptr if the ChessSquare is empty.
+const ChessPiece* ChessBoard::pieceAt(const ChessSquare& square)
+    const noexcept {
+    BoardConstIterator i = this->board.find(square);
+    return (i != this->board.end()) ? i->second : nullptr;
+}
+
+// Public Method: getOccupancy
+// ===========================
+// Returns the squares occupied by any piece. Like the methods below,
+// it reads the compact copy of the Board, which is kept in sync.
+Bitboard ChessBoard::getOccupancy() const noexcept {
+    return this->position.getPieces();
+}
+
+// Public Method: getOccupancy
+// ===========================
+// Returns the squares occupied by the pieces of a Color.
+Bitboard ChessBoard::getOccupancy(Color color) const noexcept {
+    return this->position.getPieces(color);
+}
+
+// Public Method: getOccupancy
+// ===========================
+// Returns the squares occupied by the pieces of a PieceType.
+Bitboard ChessBoard::getOccupancy(PieceType type) const noexcept {
+    return this->position.getPieces(type);
+}
+
+// Public Method: attackedBy
+// =========================
+// Returns every square attacked by a piece of the given Color. Like the
+// two methods below, it reads the attack tables of the compact copy of
+// the Board rather than asking each ChessPiece, so it costs no more
+// than a lookup per piece.
+Bitboard ChessBoard::attackedBy(Color color) const noexcept {
+    return this->position.attackedBy(color);
+}
+
+// Public Method: attackersOf
+// ==========================
+// Takes a ChessSquare and a Color and returns the squares
+// of the pieces of that Color attacking the ChessSquare.
+Bitboard ChessBoard::attackersOf(const ChessSquare& square,
+                                 Color color) const noexcept {
+    return this->position.attackersOf(squareIndex(square.getFile(),
+                                                  square.getRank()),
+                                      color);
+}
+
+// Public Method: hangingPieces
+// ============================
+// Returns the squares of the pieces of the given Color, other
+// than its King, that are attacked and not defended.
+Bitboard ChessBoard::hangingPieces(Color color) const noexcept {
+    return this->position.hangingPieces(color);
+}
+
+// Public Method: legalDestinations
+// =================================
+// Takes a ChessSquare and returns the squares the piece on it can move
+// to. If the destinations are not known for the current position yet,
+// every legal move is generated once and the destination of each is
+// recorded under its source square.
+Bitboard ChessBoard::legalDestinations(const ChessSquare& square) const {
+    Key key = this->position.getKey();
+    if (!this->areDestinationsValid || this->destinationsKey != key) {
+        for (int i = 0; i < NUM_SQUARES; ++i) {
+            this->destinations[i] = EMPTY_BITBOARD;
+        }
+        if (!this->isGameOver) {
+            MoveList moves;
+            MoveGenerator(this->position).generateLegal(moves);
+            for (Move move : moves) {
+                this->destinations[move.getFrom()] |=
+                    squareBit(move.getTo());
+            }
+        }
+        this->destinationsKey = key;
+        this->areDestinationsValid = true;
+    }
+    return this->destinations[squareIndex(square.getFile(),
+                                          square.getRank())];
+}
+
+// Public Method: getSquares
+// =========================
+// Takes a Color and a PieceType and returns the
+// squares of the pieces of that Color and PieceType.
+SquareRange ChessBoard::getSquares(Color color, PieceType type)
+    const noexcept {
+    return SquareRange(this->position.getPieces(color, type));
+}
+
+// Public Method: getOccupiedSquares
+// =================================
+// Returns the squares occupied by any piece, lowest first.
+SquareRange ChessBoard::getOccupiedSquares() const noexcept {
+    return SquareRange(this->position.getPieces());
+}
+
+// Public Method: getSnapshot
+// ===========================
+// Returns a compact copy of the state of the game as of the last move
+// played. It may be called from any thread, as it reads the snapshot
+// published through a SeqLock rather than the Board.
+BoardSnapshot ChessBoard::getSnapshot() const {
+    return this->snapshot.load();
+}
+
+// Public Method: subscribe
+// =========================
+// Returns a cursor over the MoveEvents of the moves played from now on.
+MoveEventCursor ChessBoard::subscribe() const {
+    return MoveEventCursor(this->events, this->events.getHead());
+}
+
+// Public Method: getPosition
+// ===========================
+// This method returns the compact copy of the Board used by the
+// engine, e.g. to search for the best move with Search.
+const Position& ChessBoard::getPosition() const {
+    return this->position;
+}
+
 // Public Method: getKingSquare
 // ============================
 // This method takes a Color and returns the ChessSquare
@@ -556,9 +1019,9 @@ const ChessSquare ChessBoard::getKingSquare(Color color) const {
 
     // Default to returning White's King ChessSquare,
     // but issue a warning to the client just in case.
-    cout << "WARNING! Color argument to ChessBoard::getKingSquare did "
-         << "not match Black or White. Check for possible corruption."
-         << endl;
+    this->sink->errorRaised("WARNING! Color argument to "
+                            "ChessBoard::getKingSquare did not match Black "
+                            "or White. Check for possible corruption.");
     return this->whiteKingSquare;
 }
 
@@ -577,9 +1040,9 @@ const ChessSquare ChessBoard::getKingStartSquare(Color color) const {
 
     // Default to returning White's King start ChessSquare,
     // but issue a warning to the client just in case.
-    cout << "WARNING! Color argument to ChessBoard::getKingSquare did "
-         << "not match Black or White. Check for possible corruption."
-         << endl;
+    this->sink->errorRaised("WARNING! Color argument to "
+                            "ChessBoard::getKingSquare did not match Black "
+                            "or White. Check for possible corruption.");
     return ChessSquare(WHITE_KING_SQUARE);
 }
 
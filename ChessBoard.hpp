@@ -7,6 +7,7 @@
 #ifndef CHESS_BOARD_HPP
 #define CHESS_BOARD_HPP
 
+#include <chrono>
 #include <iostream>
 #include <utility>
 #include <map>
@@ -15,6 +16,17 @@ using namespace std;
 #include "ChessSet.hpp"
 #include "ChessPiece.hpp"
 #include "ChessSquare.hpp"
+#include "Position.hpp"
+#include "MoveResult.hpp"
+#include "BoardSnapshot.hpp"
+#include "SeqLock.hpp"
+#include "MoveEvent.hpp"
+#include "SpmcRing.hpp"
+#include "NotificationSink.hpp"
+#include "Termination.hpp"
+#include "Speculator.hpp"
+#include "PremoveQueue.hpp"
+#include "GameHistory.hpp"
 
 // Type: Board & Iterators
 // =======================
@@ -43,6 +55,36 @@ class ChessBoard {
         Board board;            // Map squares to pointers to pieces.
         Color turn;             // Track whose turn it is.
         bool isGameOver;        // Indicate if a game is over.
+        NotificationSink* sink; // Notified about the game.
+        Position position;      // Compact copy of the Board.
+        unsigned int plyCount;  // Moves played so far.
+        TerminationDetector termination; // Tells when the game is drawn.
+        PremoveQueue premoves[2];   // Moves queued by each Color.
+
+        // The MoveResult of each queued move played, or dropped as no
+        // longer valid, after the last move submitted, in order. Both
+        // queues can be played out in full, then one move dropped.
+        MoveResult premoveResults[2 * MAX_PREMOVES];
+        int premoveResultCount;
+        GameHistory history;        // Moves played, to go back and forth.
+
+        // The legal destinations of the piece on each square, computed
+        // for the Position with the given hash when first asked for and
+        // kept until the next move is played.
+        mutable Bitboard destinations[NUM_SQUARES];
+        mutable Key destinationsKey;
+        mutable bool areDestinationsValid;
+
+        // Snapshot of the game and stream of the moves played, both
+        // published after every move for readers on other threads.
+        SeqLock<BoardSnapshot> snapshot;
+        SpmcRing<MoveEvent> events;
+        chrono::steady_clock::time_point startTime;
+
+        // Validates the replies to each move ahead of time, if set,
+        // filling in the ReplyTable, which is allocated along with it.
+        Speculator* speculator;
+        ReplyTable* replies;
 
         // Tracks the position of each King.
         ChessSquare whiteKingSquare;
@@ -65,6 +107,74 @@ class ChessBoard {
         // the Board given the square property of each ChessPiece.
         void arrangeSide(Color color);
 
+        // Method: syncPosition
+        // ====================
+        // Rebuilds the position property from the Board, so that
+        // the compact copy of the game matches the pieces in play.
+        void syncPosition();
+
+        // Method: publish
+        // ===============
+        // Takes the MoveResult of the Move that has just been played, or
+        // nothing if a game has just started, and publishes a MoveEvent
+        // and a BoardSnapshot of the game for readers on other threads.
+        // If isJump is true, the game has instead just been taken to
+        // another ply of its history, which the given MoveResult, if
+        // any, is the last move of.
+        void publish(const MoveResult* result = nullptr, bool isJump = false);
+
+        // Method: commitMove
+        // ==================
+        // Takes a Move and plays it on the Board if it is valid in a
+        // game that is not over, then publishes it. Returns its
+        // MoveResult, without notifying the client.
+        MoveResult commitMove(Move move);
+
+        // Method: playPremoves
+        // ====================
+        // Plays the moves queued by the player to move, if any, one
+        // after the other for as long as each is valid and it is their
+        // turn again, and notifies the client of each. If a queued move
+        // is no longer valid, it and the rest of that player's queue
+        // are dropped. The MoveResult of each is kept for the client.
+        void playPremoves();
+
+        // Method: takeCheckpoint
+        // ======================
+        // Returns a HistoryCheckpoint of the current state of the game.
+        HistoryCheckpoint takeCheckpoint() const;
+
+        // Method: restoreCheckpoint
+        // =========================
+        // Takes a HistoryCheckpoint and puts the Position, the Board
+        // and the pieces back the way they were when it was taken.
+        void restoreCheckpoint(const HistoryCheckpoint& checkpoint);
+
+        // Method: stepForward
+        // ===================
+        // Takes a ply and plays the move recorded at it again, on the
+        // Position and on the Board, without validating it.
+        void stepForward(int ply);
+
+        // Method: stepBack
+        // ================
+        // Takes a ply and takes back the move recorded at it, which
+        // must be the last move played, on the Position and the Board.
+        void stepBack(int ply);
+
+        // Method: finishJump
+        // ==================
+        // Brings the rest of the state of the game in line with the
+        // ply of the history the Position and Board have been taken
+        // to, and lets readers on other threads see it.
+        void finishJump(int ply);
+
+        // Method: speculate
+        // =================
+        // Asks the Speculator, if any, for the replies to the
+        // current position, unless the game is over.
+        void speculate();
+
         // Method: cleanUp
         // ===============
         // This method empties the Board by setting the values
@@ -96,74 +206,12 @@ class ChessBoard {
         // Takes source and destination ChessPiece pointers, and source
         // and destination ChessSquare objects by reference and updates
         // the state of the Board and the pieces to reflect a move of the
-        // ChessPiece at source to the destination ChessSquare. This
-        // method is also used in conjunction with ChessBoard::reverse to
-        // play out moves to check for check, checkmate and stalemate.
+        // ChessPiece at source to the destination ChessSquare.
         void update(ChessPiece* sourcePiece,
                     ChessPiece* destinationPiece,
                     ChessSquare& sourceSquare,
                     ChessSquare& destinationSquare);
         
-        // Method: reverse
-        // ===============
-        // Takes source and destination ChessPiece pointers, and source
-        // and destination ChessSquare objects by reference and updates
-        // the state of the Board and the pieces to reflect reversing a
-        // move of the ChessPiece at source to the destination ChessSquare
-        // back to its source ChessSquare. This method is used with
-        // ChessBoard::update to check for check, checkmate and stalemate.
-        void reverse(ChessPiece* sourcePiece,
-                     ChessPiece* destinationPiece,
-                     ChessSquare& sourceSquare,
-                     ChessSquare& destinationSquare);
-
-        // Method: isObstructed
-        // ====================
-        // Takes two ChessSquare objects by reference and returns a bool
-        // indicating if there are any pieces in the squares between them.
-        bool isObstructed(ChessSquare& source,
-                          ChessSquare& destination) const;
-
-        // Method: isInCheck
-        // =================
-        // This method takes a Color and returns a bool indicating
-        // whether or not the King of the given Color is in check.
-        bool isInCheck(Color color) const;
-
-        // Method: hasValidMove
-        // ====================
-        // Takes a Color and returns a bool indicating if the side of
-        // the given Color can make a valid move.
-        bool hasValidMove(Color color);
-
-        // Method: isPossibleMove
-        // ======================
-        // Takes source and destination ChessSquare objects by reference,
-        // and source and destination ChessPiece pointers, and returns a
-        // bool indicating if the move is possible given the rules of
-        // movement for the source piece and any possible obstructions.
-        // Returning true doesn't mean that this move is valid, as it
-        // doesn't ensure that the move doesn't leave its King in check.
-        bool isPossibleMove(ChessSquare& sourceSquare,
-                            ChessSquare& destinationSquare,
-                            ChessPiece* sourcePiece,
-                            ChessPiece* destinationPiece) const;
-
-        // Method: isValidMove
-        // ===================
-        // Takes source and destination ChessSquare objects, source and
-        // destination ChessPiece pointers, a stringstream and a bool,
-        // and returns a bool indicating if the move is valid. The
-        // stringstream is used to insert messages that might be later
-        // on printed out to the client. If the isQuiet argument is
-        // true, any errors are silenced. That is used when playing out
-        // moves when checking for check, checkmate and stalemate.
-        bool isValidMove(ChessSquare sourceSquare,
-                         ChessSquare destinationSquare,
-                         ChessPiece* sourcePiece,
-                         ChessPiece* destinationPiece,
-                         stringstream& ssSuccess, bool isQuiet);
-
         // Method: printTopLine
         // ====================
         // This method prints the top line of the ChessBoard.
@@ -186,6 +234,20 @@ class ChessBoard {
         // ====================
         ChessBoard();
 
+        // Constructor:
+        // ============
+        // Takes a bool indicating whether the ChessBoard should keep
+        // quiet, i.e. not notify the client about the game, e.g. when
+        // it is driven by a program rather than played on the console.
+        ChessBoard(bool isQuiet);
+
+        // Constructor:
+        // ============
+        // Takes the NotificationSink to notify about the game, which is
+        // not copied and must outlive the ChessBoard. Otherwise it
+        // behaves just like the default constructor.
+        ChessBoard(NotificationSink& sink);
+
         // Destructor:
         // ===========
         virtual ~ChessBoard();
@@ -197,16 +259,209 @@ class ChessBoard {
         // "A1", "H4" and persists it on the Board if the move is valid.
         void submitMove(string source, string destination);
 
+        // Method: submitMove
+        // ==================
+        // Takes source and destination ChessSquare objects and persists
+        // the move on the Board if it is valid. Nothing is printed: the
+        // returned MoveResult tells whether the move was played, why not
+        // otherwise, and whether it captured, checked or ended the game.
+        // Inserting it into a stream renders the message for the client.
+        // The moves queued by the opponent that are then played are
+        // notified through the NotificationSink, and their results can
+        // be read with getPremoveResult.
+        MoveResult submitMove(const ChessSquare& source,
+                              const ChessSquare& destination);
+
+        // Method: submitMove
+        // ==================
+        // Takes a Move and persists it on the Board if it is valid. It
+        // behaves just like submitMove with ChessSquare objects, but
+        // skips building them for clients that already hold a Move.
+        MoveResult submitMove(Move move);
+
+        // Method: queuePremove
+        // ====================
+        // Takes a Color and source and destination ChessSquare objects
+        // and queues the move, to be played as soon as the opponent's
+        // move is accepted if it is then valid, in the same call to
+        // submitMove. Returns false if the game is over, it is already
+        // the turn of that Color or MAX_PREMOVES moves are queued.
+        bool queuePremove(Color color, const ChessSquare& source,
+                          const ChessSquare& destination);
+
+        // Method: clearPremoves
+        // =====================
+        // Takes a Color and drops every move it has queued.
+        void clearPremoves(Color color);
+
+        // Method: getPremoveCount
+        // =======================
+        // Takes a Color and returns the number of moves it has queued.
+        int getPremoveCount(Color color) const;
+
+        // Method: getPremoveResultCount
+        // =============================
+        // Returns the number of queued moves that were played, or
+        // dropped as no longer valid, after the last move submitted.
+        int getPremoveResultCount() const;
+
+        // Method: getPremoveResult
+        // ========================
+        // Takes an index below getPremoveResultCount and returns the
+        // MoveResult of that queued move, in the order they were tried.
+        // Only the last one can have not been played, in which case the
+        // rest of that player's queue was dropped with it.
+        const MoveResult& getPremoveResult(int index) const;
+
+        // Method: takeBack
+        // ================
+        // Takes back the last move played, e.g. to correct a mistake or
+        // to analyse another line, at the cost of a single unmake. The
+        // move can be played again with redoMove until another move is
+        // submitted. Returns false if no move has been played.
+        bool takeBack();
+
+        // Method: redoMove
+        // ================
+        // Plays the last move taken back again. Returns false if
+        // there is none, i.e. no move was taken back or a move has
+        // been submitted since.
+        bool redoMove();
+
+        // Method: gotoPly
+        // ===============
+        // Takes a ply, i.e. a number of moves from the start of the
+        // game, and takes the game to that point of its history, taking
+        // moves back or playing them again. Checkpoints are kept every
+        // HISTORY_CHECKPOINT_PLIES moves, so this never costs more than
+        // that many moves, however long the game. Returns false if the
+        // ply is after the last move recorded. Queued moves are dropped.
+        bool gotoPly(int ply);
+
+        // Method: getPly
+        // ==============
+        // Returns the number of moves played to reach the current
+        // position, not counting those taken back.
+        int getPly() const;
+
+        // Method: getHistoryLength
+        // ========================
+        // Returns the number of moves recorded in the history of the
+        // game, counting those taken back that may be played again.
+        int getHistoryLength() const;
+
+        // Method: setSink
+        // ===============
+        // Takes the NotificationSink to notify about the game from now
+        // on, which is not copied and must outlive the ChessBoard.
+        void setSink(NotificationSink& sink);
+
+        // Method: setSpeculator
+        // =====================
+        // Takes a Speculator to validate the replies to each move while
+        // the player to move is thinking, so that submitting one of them
+        // costs little more than a lookup, or a nullptr to stop doing so.
+        // The Speculator must outlive the ChessBoard or be unset first.
+        void setSpeculator(Speculator* speculator);
+
         // Method: resetBoard
         // ==================
         // This method resets the chess board back to its initial state.
         void resetBoard();
    
+        // Method: setPosition
+        // ===================
+        // Takes a position in Forsyth-Edwards Notation and sets up the
+        // Board accordingly. Returns false, leaving the Board untouched,
+        // if the position cannot be read or set up with a ChessSet, or
+        // if it could not arise in a game.
+        bool setPosition(const string& fen);
+
         // Method: getBoard
         // ================
         // This method returns the board property of the ChessBoard.
+        // It copies the whole map, so a client that only needs to read
+        // the board should use the methods below, which copy nothing.
         Board getBoard() const;
 
+        // Method: pieceAt
+        // ===============
+        // Takes a ChessSquare and returns the ChessPiece on it,
+        // or a nullptr if the ChessSquare is empty.
+        const ChessPiece* pieceAt(const ChessSquare& square) const noexcept;
+
+        // Method: getOccupancy
+        // ====================
+        // Returns the squares occupied by any piece, by the pieces of
+        // a Color, or by the pieces of a PieceType, as a Bitboard.
+        Bitboard getOccupancy() const noexcept;
+        Bitboard getOccupancy(Color color) const noexcept;
+        Bitboard getOccupancy(PieceType type) const noexcept;
+
+        // Method: attackedBy
+        // ==================
+        // Returns every square attacked by a piece of the given Color,
+        // including the squares of the pieces of its own it defends.
+        Bitboard attackedBy(Color color) const noexcept;
+
+        // Method: attackersOf
+        // ===================
+        // Takes a ChessSquare and a Color and returns the squares
+        // of the pieces of that Color attacking the ChessSquare.
+        Bitboard attackersOf(const ChessSquare& square,
+                             Color color) const noexcept;
+
+        // Method: hangingPieces
+        // =====================
+        // Returns the squares of the pieces of the given Color, other
+        // than its King, that are attacked and not defended.
+        Bitboard hangingPieces(Color color) const noexcept;
+
+        // Method: legalDestinations
+        // =========================
+        // Takes a ChessSquare and returns the squares the piece on it
+        // can move to, e.g. to highlight them when the piece is picked
+        // up. The Bitboard is empty if the ChessSquare is empty, holds
+        // a piece of the player whose turn it is not or the game is
+        // over. The destinations of every piece are computed at once
+        // the first time one is asked for in a position, so any call
+        // after that in the same position is a single lookup.
+        Bitboard legalDestinations(const ChessSquare& square) const;
+
+        // Method: getSquares
+        // ==================
+        // Takes a Color and a PieceType and returns the squares of the
+        // pieces of that Color and PieceType, e.g. to walk them with
+        // a range-based for loop, each as the index of its square.
+        SquareRange getSquares(Color color, PieceType type) const noexcept;
+
+        // Method: getOccupiedSquares
+        // ==========================
+        // Returns the squares occupied by any piece, lowest first,
+        // e.g. to walk them with a range-based for loop.
+        SquareRange getOccupiedSquares() const noexcept;
+
+        // Method: getSnapshot
+        // ===================
+        // Returns a compact copy of the state of the game as of the last
+        // move played. Unlike every other method, it may be called from
+        // any thread, even while a move is submitted on another one. It
+        // never takes a lock, allocates or holds up the moves.
+        BoardSnapshot getSnapshot() const;
+
+        // Method: subscribe
+        // =================
+        // Returns a cursor over the MoveEvents of the moves played from
+        // now on. Like getSnapshot, it may be called from any thread,
+        // and the cursor may be read from any thread too.
+        MoveEventCursor subscribe() const;
+
+        // Method: getPosition
+        // ===================
+        // This method returns the compact copy of the Board used by
+        // the engine, e.g. to search for the best move with Search.
+        const Position& getPosition() const;
+
         // Method: getKingSquare
         // =====================
         // This method takes a Color and returns the ChessSquare
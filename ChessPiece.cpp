@@ -7,16 +7,44 @@
 #include "ChessPiece.hpp"
 #include "Settings.hpp"
 
+// Lookup Table: PIECE_DESCRIPTORS
+// ===============================
+// The PieceDescriptor of each Color and PieceType, built from the
+// constants in Settings.hpp when the program is compiled.
+constexpr PieceDescriptor PIECE_DESCRIPTORS[2][NoPieceType + 1] = {
+    {
+        {PAWN_NAME, WHITE_PAWN, PIECE_VALUES[PawnType]},
+        {KNIGHT_NAME, WHITE_KNIGHT, PIECE_VALUES[KnightType]},
+        {BISHOP_NAME, WHITE_BISHOP, PIECE_VALUES[BishopType]},
+        {ROOK_NAME, WHITE_ROOK, PIECE_VALUES[RookType]},
+        {QUEEN_NAME, WHITE_QUEEN, PIECE_VALUES[QueenType]},
+        {KING_NAME, WHITE_KING, PIECE_VALUES[KingType]},
+        {CHESS_PIECE_NAME, WHITE_SYMBOL, PIECE_VALUES[NoPieceType]}
+    },
+    {
+        {PAWN_NAME, BLACK_PAWN, PIECE_VALUES[PawnType]},
+        {KNIGHT_NAME, BLACK_KNIGHT, PIECE_VALUES[KnightType]},
+        {BISHOP_NAME, BLACK_BISHOP, PIECE_VALUES[BishopType]},
+        {ROOK_NAME, BLACK_ROOK, PIECE_VALUES[RookType]},
+        {QUEEN_NAME, BLACK_QUEEN, PIECE_VALUES[QueenType]},
+        {KING_NAME, BLACK_KING, PIECE_VALUES[KingType]},
+        {CHESS_PIECE_NAME, BLACK_SYMBOL, PIECE_VALUES[NoPieceType]}
+    }
+};
+
 // Constructor: Default
 // ====================
-ChessPiece::ChessPiece() {};
+// Constructs a White ChessPiece of no type that is not on the board,
+// so that its descriptor is always a valid entry of the table.
+ChessPiece::ChessPiece() : color(White), type(NoPieceType) {
+    this->square = nullptr;
+}
 
 // Constructor: Copy
 // =================
 ChessPiece::ChessPiece(const ChessPiece& other) {
-    this->name = other.name;
     this->color = other.color;
-    this->symbol = other.symbol;
+    this->type = other.type;
     this->square = other.square;
 }
 
@@ -25,9 +53,8 @@ ChessPiece::ChessPiece(const ChessPiece& other) {
 // This constructor takes a Color and a ChessSquare and
 // constructs a ChessPiece of that Color and sets its
 // square property to point to the given ChessSquare.
-ChessPiece::ChessPiece(Color c, const ChessSquare& square) : color(c) {
-    this->name = CHESS_PIECE_NAME;
-    this->initSymbol(c);
+ChessPiece::ChessPiece(Color c, const ChessSquare& square)
+    : color(c), type(NoPieceType) {
     this->square = new ChessSquare(square);
 }
 
@@ -35,9 +62,7 @@ ChessPiece::ChessPiece(Color c, const ChessSquare& square) : color(c) {
 // ============
 // This constructor takes a Color and creates
 // a ChessPiece object of that Color.
-ChessPiece::ChessPiece(Color c) : color(c) {
-    this->name = CHESS_PIECE_NAME;
-    this->initSymbol(c);
+ChessPiece::ChessPiece(Color c) : color(c), type(NoPieceType) {
     this->square = nullptr;
 }
 
@@ -52,14 +77,6 @@ ChessPiece::~ChessPiece() {
     this->square = nullptr;
 }
 
-// Private Method: initSymbol
-// ==========================
-// This method initialises the symbol property
-// of the ChessPiece given its Color.
-void ChessPiece::initSymbol(Color color) {
-    this->symbol = (color == White) ? WHITE_SYMBOL : BLACK_SYMBOL;
-}
-
 // Public Method: setSquare
 // ========================
 // Takes a ChessSquare, creates a copy of that ChessSquare and sets
@@ -123,32 +140,53 @@ Color ChessPiece::getColor() const {
     return this->color;
 }
 
+// Public Method: getType
+// ======================
+// This method returns the type property of the ChessPiece.
+PieceType ChessPiece::getType() const {
+    return this->type;
+}
+
+// Public Method: getDescriptor
+// =============================
+// This method returns the PieceDescriptor of the ChessPiece.
+const PieceDescriptor& ChessPiece::getDescriptor() const {
+    return ::getDescriptor(this->color, this->type);
+}
+
 // Public Method: getSymbol
 // ========================
-// This method returns the symbol property of the ChessPiece.
-string ChessPiece::getSymbol() const {
-    return this->symbol;
+// This method returns the Unicode symbol of the ChessPiece.
+string_view ChessPiece::getSymbol() const {
+    return this->getDescriptor().symbol;
 }
 
 // Public Method: getName
 // ======================
-// This method returns the name property of the ChessPiece.
-string ChessPiece::getName() const {
-    return this->name;
+// This method returns the English name of the ChessPiece.
+string_view ChessPiece::getName() const {
+    return this->getDescriptor().name;
+}
+
+// Public Method: getValue
+// =======================
+// This method returns the value of the ChessPiece in centipawns.
+int ChessPiece::getValue() const {
+    return this->getDescriptor().value;
 }
 
 // Public Method: print
 // ====================
-// This method prints the symbol property of the ChessPiece.
+// This method prints the symbol of the ChessPiece.
 void ChessPiece::print() const {
-    cout << this->symbol;
+    cout << this->getSymbol();
 }
 
 // Friend Operator: <<
 // ===================
-// Outputs the symbol property of the ChessPiece operand.
+// Outputs the symbol of the ChessPiece operand.
 ostream& operator<<(ostream& os, const ChessPiece& piece) {
-    os << piece.symbol;
+    os << piece.getSymbol();
     return os;
 }
 
@@ -182,10 +220,7 @@ Color operator!(const Color& color) {
             return White;
     }
 
-    // By default return White, but notify client
-    // that there is a potential problem with Color.
-    cout << "ERROR! Invalid Color. Returning White as "
-         << "default. Check for possible corruption."
-         << endl;
+    // Unreachable for a valid Color; return White to
+    // keep the compiler happy.
     return White;
 }
@@ -1,5 +1,4 @@
 // ==========================================
-    font-spacing: 1.5;
 // File:    ChessPiece.hpp
 // Author:  Juan Carlos Farah
 // Email:   juancarlos.farah14@imperial.ac.uk
@@ -10,6 +9,7 @@
 
 #include <iostream>
 #include <string>
+#include <string_view>
 using namespace std;
 
 #include "ChessSquare.hpp"
@@ -20,28 +20,53 @@ using namespace std;
 // and Black. These are represented by this enum.
 enum Color {White, Black};
 
+// Enum: PieceType
+// ===============
+// Each ChessPiece is of one of these six types. NoPieceType is
+// used wherever a type is needed but no piece is present.
+enum PieceType {PawnType, KnightType, BishopType,
+                RookType, QueenType, KingType, NoPieceType};
+
+// Struct: PieceDescriptor
+// =======================
+// Describes every ChessPiece of one PieceType and Color: its English
+// name, its Unicode symbol and its value in centipawns. There is one
+// shared, read-only PieceDescriptor per PieceType and Color, which a
+// ChessPiece finds through its type and color, so that no ChessPiece
+// has to hold strings of its own.
+struct PieceDescriptor {
+    string_view name;       // English name.
+    string_view symbol;     // Unicode symbol.
+    int value;              // Value in centipawns.
+};
+
+// Lookup Table: PIECE_DESCRIPTORS
+// ===============================
+// The PieceDescriptor of each Color and PieceType. The entries for
+// NoPieceType describe a generic ChessPiece, with a symbol that only
+// tells its Color and no value.
+extern const PieceDescriptor PIECE_DESCRIPTORS[2][NoPieceType + 1];
+
+// Function: getDescriptor
+// =======================
+// Returns the PieceDescriptor of the given Color and PieceType.
+inline const PieceDescriptor& getDescriptor(int color, int type) {
+    return PIECE_DESCRIPTORS[color][type];
+}
+
 // Class: ChessPiece
 // =================
 // This class defines the data members and methods of the ChessPiece,
 // which serves as a superclass for every type of ChessPiece used in
-// a game of chess. This class defines how a ChessPiece can move, the
-// name and symbol it is given, as well as its Color (indicating its
-// side) and the ChessSquare it is currently on.
+// a game of chess. This class defines how a ChessPiece can move, its
+// Color (indicating its side) and the ChessSquare it is currently on.
+// Its name and symbol are those of the PieceDescriptor of its type.
 class ChessPiece {
 
-    private:
-
-        // Method: initSymbol
-        // ==================
-        // This method initialises the symbol property
-        // of the ChessPiece given its Color.
-        void initSymbol(Color color);
-
     protected:
 
         Color color;        // Color
-        string name;        // English name.
-        string symbol;      // Unicode symbol.
+        PieceType type;     // Type, which with Color picks the descriptor.
 
         // This points to the ChessSquare this ChessPiece
         // is currently on. If the piece has been captured,
@@ -107,24 +132,39 @@ class ChessPiece {
         // This method returns the color property of the ChessPiece.
         Color getColor() const;
 
+        // Method: getType
+        // ===============
+        // This method returns the type property of the ChessPiece.
+        PieceType getType() const;
+
+        // Method: getDescriptor
+        // ======================
+        // This method returns the PieceDescriptor of the ChessPiece.
+        const PieceDescriptor& getDescriptor() const;
+
         // Method: getSymbol
         // =================
-        // This method returns the symbol property of the ChessPiece.
-        string getSymbol() const;
+        // This method returns the Unicode symbol of the ChessPiece.
+        string_view getSymbol() const;
 
         // Method: getName
         // ================
-        // This method returns the name property of the ChessPiece.
-        string getName() const;
+        // This method returns the English name of the ChessPiece.
+        string_view getName() const;
+
+        // Method: getValue
+        // ================
+        // This method returns the value of the ChessPiece in centipawns.
+        int getValue() const;
 
         // Method: print
         // =============
-        // This method prints the symbol property of the ChessPiece.
+        // This method prints the symbol of the ChessPiece.
         void print() const;
 
         // Operator: <<
         // ============
-        // Outputs the symbol property of the ChessPiece operand.
+        // Outputs the symbol of the ChessPiece operand.
         friend ostream& operator<<(ostream& os, const ChessPiece& piece);
 };
 
@@ -37,8 +37,7 @@ ChessSquare::ChessSquare(ChessSquare* other) {
 // and int elements, with which it constructs the respective
 // ChessSquare object. If the string passed in is invalid, the
 // constructor throws an InvalidCoordinatesException.
-ChessSquare::ChessSquare(string coordinates)
-                         throw(InvalidCoordinatesException&) {
+ChessSquare::ChessSquare(string coordinates) {
 
     // Allowing char input to be lowercase
     // so always convert it to uppercase.
@@ -62,8 +61,7 @@ ChessSquare::ChessSquare(string coordinates)
 // This constructor takes a char file and an int rank and constructs
 // the respective ChessSquare object. If the arguments are invalid,
 // it throws an InvalidCoordinatesException.
-ChessSquare::ChessSquare(char file, int rank)
-                         throw(InvalidCoordinatesException&) {
+ChessSquare::ChessSquare(char file, int rank) {
 
     // Allowing char input to be lowercase
     // so always convert it to uppercase.
@@ -64,16 +64,14 @@ class ChessSquare {
         // and int elements, with which it constructs the respective
         // ChessSquare object. If the string passed in is invalid, the
         // constructor throws an InvalidCoordinatesException.
-        ChessSquare(string coordinates)
-                    throw(InvalidCoordinatesException&);
+        ChessSquare(string coordinates);
 
         // Constructor:
         // ============
         // This constructor takes a char file and an int rank and
         // constructs the respective ChessSquare object. If the arguments
         // are invalid, it throws an InvalidCoordinatesException.
-        ChessSquare(char file, int rank)
-                    throw(InvalidCoordinatesException&);
+        ChessSquare(char file, int rank);
 
         // Destructor:
         // ===========
@@ -0,0 +1,80 @@
+// ==========================================
+// File:    Evaluation.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include "Evaluation.hpp"
+
+// Constructor: Default
+// ====================
+Evaluation::Evaluation() : network(nullptr) {}
+
+// Public Method: setNetwork
+// =========================
+// Takes a loaded Network to evaluate with, or a nullptr to go
+// back to the material and piece-square evaluation.
+void Evaluation::setNetwork(const Network* network) {
+    if (network != nullptr && !network->isLoaded()) network = nullptr;
+    this->network = network;
+    this->accumulators.setNetwork(network);
+}
+
+// Public Method: reset
+// ====================
+// Prepares the Evaluation for a new search from the root.
+void Evaluation::reset() {
+    this->accumulators.reset();
+}
+
+// Public Method: pushMove
+// =======================
+// Takes the Position right after the given Move has been played
+// on it and the UndoInfo filled in by makeMove.
+void Evaluation::pushMove(const Position& position, Move move,
+                          const UndoInfo& undo) {
+    if (this->network == nullptr) return;
+    this->accumulators.push(move, position.pieceOn(move.getTo()),
+                            undo.captured);
+}
+
+// Public Method: popMove
+// ======================
+// Signals that the last move pushed has been taken back.
+void Evaluation::popMove() {
+    if (this->network == nullptr) return;
+    this->accumulators.pop();
+}
+
+// Public Method: evaluate
+// =======================
+// Takes a Position and returns its score from the point of view of
+// the side to move. The middlegame and endgame scores are kept up to
+// date by the Position as moves are made and the pawn structure terms
+// come from the PawnTable, so all that is left is to blend them
+// according to the game phase: with every piece on the board the
+// middlegame score counts in full, and the endgame score takes over
+// as pieces are traded.
+int Evaluation::evaluate(const Position& position) {
+    if (this->network != nullptr) {
+        return this->accumulators.evaluate(position);
+    }
+
+    PawnEntry& pawns = this->pawnTable.probe(position);
+    int mgScore = position.getMgScore() + pawns.mgScore +
+                  PawnTable::getShield(pawns, position, White) -
+                  PawnTable::getShield(pawns, position, Black);
+    int egScore = position.getEgScore() + pawns.egScore;
+
+    int phase = position.getPhase();
+    if (phase > MAX_PHASE) phase = MAX_PHASE;
+    int score = (mgScore * phase + egScore * (MAX_PHASE - phase)) / MAX_PHASE;
+    return (position.getSideToMove() == White) ? score : -score;
+}
+
+// Public Method: getPawnTable
+// ===========================
+// Returns the PawnTable, e.g. to read its hit rate.
+const PawnTable& Evaluation::getPawnTable() const {
+    return this->pawnTable;
+}
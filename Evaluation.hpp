@@ -0,0 +1,78 @@
+// ==========================================
+// File:    Evaluation.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef EVALUATION_HPP
+#define EVALUATION_HPP
+
+#include "Position.hpp"
+#include "Network.hpp"
+#include "Accumulator.hpp"
+#include "PawnTable.hpp"
+
+// Class: Evaluation
+// =================
+// This class defines the static evaluation used by the Search. It
+// scores a Position in centipawns from the point of view of the side
+// to move, so that a positive score means that side is better off.
+// The material and piece-square terms it reads are updated incrementally
+// by the Position, and the pawn structure is looked up in a PawnTable,
+// so an evaluation rarely needs to look at the pieces one by one.
+// When given a Network, the Evaluation uses it instead, keeping its
+// accumulators up to date through pushMove and popMove, which the
+// Search calls whenever it plays or takes back a move. Each Search has
+// its own Evaluation, so none of this state is shared between threads.
+class Evaluation {
+
+    private:
+
+        const Network* network;         // Network used, if any.
+        AccumulatorStack accumulators;  // Accumulators of the Network.
+        PawnTable pawnTable;            // Cached pawn structure terms.
+
+    public:
+
+        // Constructor: Default
+        // ====================
+        Evaluation();
+
+        // Method: setNetwork
+        // ==================
+        // Takes a loaded Network to evaluate with, or a nullptr
+        // to go back to the material and piece-square evaluation.
+        void setNetwork(const Network* network);
+
+        // Method: reset
+        // =============
+        // Prepares the Evaluation for a new search from the root.
+        void reset();
+
+        // Method: pushMove
+        // ================
+        // Takes the Position right after the given Move has been
+        // played on it and the UndoInfo filled in by makeMove.
+        void pushMove(const Position& position, Move move,
+                      const UndoInfo& undo);
+
+        // Method: popMove
+        // ===============
+        // Signals that the last move pushed has been taken back.
+        void popMove();
+
+        // Method: evaluate
+        // ================
+        // Takes a Position and returns its score from the point of
+        // view of the side to move. Without a Network, the score blends
+        // the material, piece-square and pawn structure scores for the
+        // middlegame and the endgame according to the game phase.
+        int evaluate(const Position& position);
+
+        // Method: getPawnTable
+        // ====================
+        // Returns the PawnTable, e.g. to read its hit rate.
+        const PawnTable& getPawnTable() const;
+};
+
+#endif
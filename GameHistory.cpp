@@ -0,0 +1,112 @@
+// ==========================================
+// File:    GameHistory.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include "GameHistory.hpp"
+
+// Constructor: Default
+// ====================
+GameHistory::GameHistory() : ply(0), isStartOver(false) {}
+
+// Public Method: reset
+// ====================
+// Takes the HistoryCheckpoint of the position a game starts from and
+// whether the game is already over, and forgets any previous game. The
+// storage of the previous game is kept, so that recording the moves of
+// a game no longer than it allocates nothing.
+void GameHistory::reset(const HistoryCheckpoint& start, bool isGameOver) {
+    this->entries.clear();
+    this->keys.clear();
+    this->checkpoints.clear();
+    this->keys.push_back(start.position.getKey());
+    this->checkpoints.push_back(start);
+    this->ply = 0;
+    this->isStartOver = isGameOver;
+}
+
+// Public Method: record
+// =====================
+// Takes a HistoryEntry for a move played at the current ply and the
+// hash of the position after it, and forgets the moves taken back,
+// along with the HistoryCheckpoint objects taken after the current ply.
+void GameHistory::record(const HistoryEntry& entry, Key key) {
+    this->entries.resize(this->ply);
+    this->keys.resize(this->ply + 1);
+    size_t checkpoints = this->ply / HISTORY_CHECKPOINT_PLIES + 1;
+    if (this->checkpoints.size() > checkpoints) {
+        this->checkpoints.resize(checkpoints);
+    }
+    this->entries.push_back(entry);
+    this->keys.push_back(key);
+    ++this->ply;
+}
+
+// Public Method: isCheckpointDue
+// ==============================
+// Returns true if the current ply is a multiple of
+// HISTORY_CHECKPOINT_PLIES with no HistoryCheckpoint yet.
+bool GameHistory::isCheckpointDue() const {
+    return this->ply % HISTORY_CHECKPOINT_PLIES == 0 &&
+           static_cast<int>(this->checkpoints.size()) ==
+           this->ply / HISTORY_CHECKPOINT_PLIES;
+}
+
+// Public Method: addCheckpoint
+// ============================
+// Takes the HistoryCheckpoint of the current ply and keeps a copy.
+void GameHistory::addCheckpoint(const HistoryCheckpoint& checkpoint) {
+    this->checkpoints.push_back(checkpoint);
+}
+
+// Public Method: getCheckpoint
+// ============================
+// Returns the latest HistoryCheckpoint taken at or before the given ply.
+const HistoryCheckpoint& GameHistory::getCheckpoint(int ply) const {
+    return this->checkpoints[ply / HISTORY_CHECKPOINT_PLIES];
+}
+
+// Public Method: getEntry
+// =======================
+// Returns the HistoryEntry of the move played at the given ply.
+const HistoryEntry& GameHistory::getEntry(int ply) const {
+    return this->entries[ply];
+}
+
+// Public Method: getKeys
+// ======================
+// Returns the hashes of the positions at each ply.
+const Key* GameHistory::getKeys() const {
+    return this->keys.data();
+}
+
+// Public Method: setPly
+// =====================
+// Takes the ply the ChessBoard is now at.
+void GameHistory::setPly(int ply) {
+    this->ply = ply;
+}
+
+// Public Method: getPly
+// =====================
+// Returns the number of moves played so far.
+int GameHistory::getPly() const {
+    return this->ply;
+}
+
+// Public Method: getLength
+// ========================
+// Returns the number of moves recorded.
+int GameHistory::getLength() const {
+    return static_cast<int>(this->entries.size());
+}
+
+// Public Method: isGameOverAt
+// ===========================
+// Returns true if the game was over at the given ply, i.e. if it
+// was over from the start or the move before it ended it.
+bool GameHistory::isGameOverAt(int ply) const {
+    if (ply == 0) return this->isStartOver;
+    return this->entries[ply - 1].result.isGameOver();
+}
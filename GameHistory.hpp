@@ -0,0 +1,137 @@
+// ==========================================
+// File:    GameHistory.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef GAME_HISTORY_HPP
+#define GAME_HISTORY_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+using namespace std;
+
+#include "Settings.hpp"
+#include "ChessPiece.hpp"
+#include "Position.hpp"
+#include "MoveResult.hpp"
+
+// Struct: HistoryEntry
+// ====================
+// A move of a game as it was played on a ChessBoard: its MoveResult,
+// the ChessPiece objects it moved and captured on the Board, and the
+// number of moves since the last capture or Pawn move after it. This
+// is all it takes to play the move again or to take it back.
+struct HistoryEntry {
+    MoveResult result;      // Move played and its outcome.
+    ChessPiece* moved;      // ChessPiece moved.
+    ChessPiece* captured;   // ChessPiece captured, if any.
+    int halfmoveClock;      // Moves since a capture or Pawn move.
+};
+
+// Struct: HistoryCheckpoint
+// =========================
+// A copy of the state of a game at some move: the Position and the
+// square of each ChessPiece of the ChessSet, in the order of its two
+// ChessSide containers, or NO_SQUARE for the pieces captured so far.
+struct HistoryCheckpoint {
+    Position position;
+    uint8_t squares[2][PIECES_PER_SIDE];
+};
+
+// Class: GameHistory
+// ==================
+// This class records every move of the game played on a ChessBoard,
+// together with the hash of the position after each of them, and takes
+// a HistoryCheckpoint every HISTORY_CHECKPOINT_PLIES moves. It tracks
+// the move the ChessBoard is currently at, which may be earlier than
+// the last one recorded once moves are taken back: the moves after it
+// can then be played again until a new move is recorded instead.
+class GameHistory {
+
+    private:
+
+        vector<HistoryEntry> entries;           // Every move recorded.
+        vector<Key> keys;                       // Hash before the first
+                                                // move and after each.
+        vector<HistoryCheckpoint> checkpoints;  // One every
+                                                // HISTORY_CHECKPOINT_PLIES.
+        int ply;                                // Moves played so far.
+        bool isStartOver;                       // Whether the game was
+                                                // over before any move.
+
+    public:
+
+        // Constructor: Default
+        // ====================
+        GameHistory();
+
+        // Method: reset
+        // =============
+        // Takes the HistoryCheckpoint of the position a game starts
+        // from and whether that game is already over, and forgets
+        // everything about any previous game.
+        void reset(const HistoryCheckpoint& start, bool isGameOver);
+
+        // Method: record
+        // ==============
+        // Takes a HistoryEntry for a move played at the current ply and
+        // the hash of the position after it. Any move recorded after
+        // the current ply, i.e. taken back, is forgotten.
+        void record(const HistoryEntry& entry, Key key);
+
+        // Method: isCheckpointDue
+        // =======================
+        // Returns true if a HistoryCheckpoint of the current
+        // ply is due and has not been added yet.
+        bool isCheckpointDue() const;
+
+        // Method: addCheckpoint
+        // =====================
+        // Takes the HistoryCheckpoint of the current ply,
+        // which must be due, and keeps a copy of it.
+        void addCheckpoint(const HistoryCheckpoint& checkpoint);
+
+        // Method: getCheckpoint
+        // =====================
+        // Returns the latest HistoryCheckpoint taken at or before the
+        // given ply, which must not be after the last move recorded.
+        const HistoryCheckpoint& getCheckpoint(int ply) const;
+
+        // Method: getEntry
+        // ================
+        // Returns the HistoryEntry of the move played at the given
+        // ply, i.e. the move from that ply to the next one.
+        const HistoryEntry& getEntry(int ply) const;
+
+        // Method: getKeys
+        // ===============
+        // Returns the hashes of the positions at each ply, the
+        // position a game starts from first.
+        const Key* getKeys() const;
+
+        // Method: setPly
+        // ==============
+        // Takes the ply the ChessBoard is now at, which must not
+        // be after the last move recorded.
+        void setPly(int ply);
+
+        // Method: getPly
+        // ==============
+        // Returns the number of moves played so far.
+        int getPly() const;
+
+        // Method: getLength
+        // =================
+        // Returns the number of moves recorded, counting
+        // those taken back that may be played again.
+        int getLength() const;
+
+        // Method: isGameOverAt
+        // ====================
+        // Returns true if the game was over at the given ply.
+        bool isGameOverAt(int ply) const;
+};
+
+#endif
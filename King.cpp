@@ -12,14 +12,15 @@ using namespace std;
 
 // Constructor: Default
 // ====================
-King::King() : ChessPiece() {}
+King::King() : ChessPiece() {
+    this->type = KingType;
+}
 
 // Constructor:
 // ============
 // This constructor takes a Color and creates a King of that Color.
 King::King(Color color) : ChessPiece(color) {
-    this->name = KING_NAME;
-    this->initSymbol(color);
+    this->type = KingType;
 }
 
 // Constructor:
@@ -28,22 +29,13 @@ King::King(Color color) : ChessPiece(color) {
 // constructs a King of that Color, setting its square
 // property to point to the given ChessSquare.
 King::King(Color c, const ChessSquare& cs) : ChessPiece(c, cs) {
-    this->name = KING_NAME;
-    this->initSymbol(c);
+    this->type = KingType;
 }
 
 // Destructor:
 // ===========
 King::~King() {}
 
-// Private Method: initSymbol
-// ==========================
-// This method initialises the symbol
-// property of the King given its Color.
-void King::initSymbol(Color color) {
-    this->symbol = (color == White) ? WHITE_KING : BLACK_KING;
-}
-
 // Public Method: isPossibleMove
 // =============================
 // This method takes a ChessSquare and a pointer to the ChessPiece
@@ -76,7 +68,7 @@ pair<bool, bool> King::isPossibleMove(ChessSquare& square,
 // Friend Operator: << 
 // ===================
 // Outputs the symbol property of the King operand.
-ostream& operator<<(ostream& os, King king) { 
-    os << king.symbol;
+ostream& operator<<(ostream& os, const King& king) {
+    os << king.getSymbol();
     return os;
 }
@@ -18,14 +18,6 @@ using namespace std;
 // is a subclass of ChessPiece. This class defines how a King can move,
 // its name and the symbol it is given according to its Color.
 class King : public ChessPiece {
-    
-    private:
-
-        // Method: initSymbol
-        // ==================
-        // This method initialises the symbol
-        // property of the King given its Color.
-        void initSymbol(Color color);
 
     public:
 
@@ -56,7 +48,7 @@ class King : public ChessPiece {
         // Operator: <<
         // ============
         // Outputs the symbol property of the King operand.
-        friend ostream& operator<<(ostream& os, King king);
+        friend ostream& operator<<(ostream& os, const King& king);
 };
 
 #endif
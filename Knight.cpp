@@ -12,14 +12,15 @@ using namespace std;
 
 // Constructor: Default
 // ====================
-Knight::Knight() : ChessPiece() {}
+Knight::Knight() : ChessPiece() {
+    this->type = KnightType;
+}
 
 // Constructor:
 // ============
 // This constructor takes a Color and creates a Knight of that Color.
 Knight::Knight(Color color) : ChessPiece(color) {
-    this->name = KNIGHT_NAME;
-    this->initSymbol(color);
+    this->type = KnightType;
 }
 
 // Constructor:
@@ -28,22 +29,13 @@ Knight::Knight(Color color) : ChessPiece(color) {
 // constructs a Knight of that Color, setting its square
 // property to point to the given ChessSquare.
 Knight::Knight(Color c, const ChessSquare& cs) : ChessPiece(c, cs) {
-    this->name = KNIGHT_NAME;
-    this->initSymbol(c);
+    this->type = KnightType;
 }
 
 // Destructor:
 // ===========
 Knight::~Knight() {}
 
-// Private Method: initSymbol
-// ==========================
-// This method initialises the symbol
-// property of the Knight given its Color.
-void Knight::initSymbol(Color color) {
-    this->symbol = (color == White) ? WHITE_KNIGHT : BLACK_KNIGHT;
-}
-
 // Public Method: isPossibleMove
 // =============================
 // This method takes a ChessSquare and a pointer to the ChessPiece
@@ -76,7 +68,7 @@ pair<bool, bool> Knight::isPossibleMove(ChessSquare& square,
 // Friend Operator: <<
 // ===================
 // Outputs the symbol property of the Knight operand.
-ostream& operator<<(ostream& os, Knight knight) { 
-    os << knight.symbol;
+ostream& operator<<(ostream& os, const Knight& knight) {
+    os << knight.getSymbol();
     return os;
 }
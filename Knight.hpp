@@ -18,14 +18,6 @@ using namespace std;
 // is a subclass of ChessPiece. This class defines how a Knight can move,
 // its name and the symbol it is given according to its Color.
 class Knight : public ChessPiece {
-    
-    private:
-
-        // Method: initSymbol
-        // ==================
-        // This method initialises the symbol
-        // property of the Knight given its Color.
-        void initSymbol(Color color);
 
     public:
 
@@ -56,7 +48,7 @@ class Knight : public ChessPiece {
         // Operator: <<
         // ============
         // Outputs the symbol property of the Knight operand.
-        friend ostream& operator<<(ostream& os, Knight knight);
+        friend ostream& operator<<(ostream& os, const Knight& knight);
 };
 
 #endif
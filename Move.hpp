@@ -0,0 +1,154 @@
+// ==========================================
+// File:    Move.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef MOVE_HPP
+#define MOVE_HPP
+
+#include <cstdint>
+using namespace std;
+
+// Constants: Moves
+// ================
+// No position reachable under the rules of this program has more
+// than a couple of hundred moves, so every buffer of moves used by
+// the engine is allocated on the stack with this capacity.
+const int MAX_MOVES = 256;
+
+// Class: Move
+// ===========
+// This class is the compact representation of a move used by the
+// engine. It packs the indices of its source and destination squares
+// into the low twelve bits of a single 16-bit word, as the rest of the
+// information can be read off the Position it is played on. The top
+// four bits hold a flag, which is where the piece a Pawn promotes to
+// would go. The rules played here have no such moves, so it is zero
+// for every move generated.
+class Move {
+
+    private:
+
+        uint16_t data;          // Source, destination and flag.
+
+    public:
+
+        // Constructor: Default
+        // ====================
+        // The default Move is a null move from A1 to A1.
+        Move() : data(0) {}
+
+        // Constructor:
+        // ============
+        // Takes the indices of a source and a destination square
+        // and, optionally, a flag from 0 to 15.
+        Move(int from, int to, int flag = 0)
+            : data(static_cast<uint16_t>(from | (to << 6) | (flag << 12))) {}
+
+        // Method: getFrom
+        // ===============
+        // Returns the index of the source square.
+        int getFrom() const { return this->data & 0x3F; }
+
+        // Method: getTo
+        // =============
+        // Returns the index of the destination square.
+        int getTo() const { return (this->data >> 6) & 0x3F; }
+
+        // Method: getFlag
+        // ===============
+        // Returns the flag of the Move.
+        int getFlag() const { return this->data >> 12; }
+
+        // Method: isNull
+        // ==============
+        // Returns true if this is the default, null Move.
+        bool isNull() const {
+            return ((this->data ^ (this->data >> 6)) & 0x3F) == 0;
+        }
+
+        // Operator: ==
+        // ============
+        bool operator==(const Move& other) const {
+            return this->data == other.data;
+        }
+
+        // Operator: !=
+        // ============
+        bool operator!=(const Move& other) const {
+            return !(*this == other);
+        }
+};
+
+// Class: MoveList
+// ===============
+// This class holds up to MAX_MOVES moves in an array of its own, so
+// that building a list of moves never allocates and the list can live
+// on the stack. Moves are added at the end, and the list can be walked
+// like any other container.
+class MoveList {
+
+    private:
+
+        Move moves[MAX_MOVES];  // The moves, in the order added.
+        int count;              // Number of moves.
+
+    public:
+
+        // Constructor: Default
+        // ====================
+        // The list starts empty.
+        MoveList() : count(0) {}
+
+        // Method: add
+        // ===========
+        // Adds a Move at the end of the list, which must not be full.
+        void add(Move move) { this->moves[this->count++] = move; }
+
+        // Method: clear
+        // =============
+        // Empties the list.
+        void clear() { this->count = 0; }
+
+        // Method: resize
+        // ==============
+        // Keeps the given number of moves from the start of the list,
+        // which must not be more than it holds.
+        void resize(int size) { this->count = size; }
+
+        // Method: size
+        // ============
+        // Returns the number of moves in the list.
+        int size() const { return this->count; }
+
+        // Method: isEmpty
+        // ===============
+        // Returns true if there are no moves in the list.
+        bool isEmpty() const { return this->count == 0; }
+
+        // Method: contains
+        // ================
+        // Returns true if the given Move is in the list.
+        bool contains(Move move) const {
+            for (int i = 0; i < this->count; ++i) {
+                if (this->moves[i] == move) return true;
+            }
+            return false;
+        }
+
+        // Operator: []
+        // ============
+        Move& operator[](int index) { return this->moves[index]; }
+        Move operator[](int index) const { return this->moves[index]; }
+
+        // Methods: begin and end
+        // ======================
+        // Return pointers to the first move and just past the last one.
+        Move* begin() { return this->moves; }
+        Move* end() { return this->moves + this->count; }
+        const Move* begin() const { return this->moves; }
+        const Move* end() const { return this->moves + this->count; }
+};
+
+#endif
@@ -0,0 +1,99 @@
+// ==========================================
+// File:    MoveEvent.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef MOVE_EVENT_HPP
+#define MOVE_EVENT_HPP
+
+#include <cstdint>
+using namespace std;
+
+#include "Position.hpp"
+#include "Move.hpp"
+#include "SpmcRing.hpp"
+
+// Constants: Move Event Flags
+// ===========================
+// The bits of the flags of a MoveEvent. A new game, which is started
+// or set up rather than reached by a move, has no Move, and watchers
+// should take a fresh BoardSnapshot of it. So should they when a game
+// is taken to another point of its history, e.g. by a takeback, which
+// is flagged with JUMP_FLAG and holds the last move before that point,
+// if any. A draw other than a stalemate, e.g. by repetition, is
+// flagged with DRAW_FLAG.
+const uint8_t CAPTURE_FLAG = 1 << 0;
+const uint8_t CHECK_FLAG = 1 << 1;
+const uint8_t CHECKMATE_FLAG = 1 << 2;
+const uint8_t STALEMATE_FLAG = 1 << 3;
+const uint8_t NEW_GAME_FLAG = 1 << 4;
+const uint8_t DRAW_FLAG = 1 << 5;
+const uint8_t JUMP_FLAG = 1 << 6;
+
+// Struct: MoveEvent
+// =================
+// A compact record of a move accepted by a ChessBoard, as sent to the
+// watchers of the game. It holds only what changed, i.e. the delta
+// from the previous position, together with the Zobrist hash of the
+// resulting position, against which a watcher can check its own copy.
+struct MoveEvent {
+    Key key;            // Hash of the resulting position.
+    uint32_t time;      // Milliseconds since the game started.
+    uint32_t plyCount;  // Moves played, including this one.
+    Move move;          // Move played, null for a new game.
+    Piece captured;     // Piece captured, if any.
+    uint8_t flags;      // Any of the flags above.
+};
+
+// Class: MoveEventCursor
+// ======================
+// This class is a watcher's place in the stream of MoveEvents of a
+// ChessBoard. Each watcher keeps a cursor of its own and reads events
+// at its own pace. If it falls so far behind that the events it has
+// yet to read have been overwritten, it must resync: take a fresh
+// BoardSnapshot and carry on from the event count recorded in it.
+class MoveEventCursor {
+
+    private:
+
+        const SpmcRing<MoveEvent>* events;  // Stream being read.
+        uint64_t position;                  // Next event to read.
+
+    public:
+
+        // Constructor:
+        // ============
+        // Takes a stream of MoveEvents and the position of the
+        // first event to read from it.
+        MoveEventCursor(const SpmcRing<MoveEvent>& events, uint64_t position)
+            : events(&events), position(position) {}
+
+        // Method: next
+        // ============
+        // Copies the next event into the given MoveEvent and moves past
+        // it. Returns ReadEmpty if there is no new event yet and
+        // ReadOverrun if the cursor must be resynced.
+        ReadStatus next(MoveEvent& event) {
+            ReadStatus status = this->events->read(this->position, event);
+            if (status == ReadDone) ++this->position;
+            return status;
+        }
+
+        // Method: resync
+        // ==============
+        // Takes the event count of a BoardSnapshot, taken after falling
+        // behind, and carries on with the first event after it.
+        void resync(uint64_t eventCount) {
+            this->position = eventCount;
+        }
+
+        // Method: getLag
+        // ==============
+        // Returns how many events have been published but not read.
+        uint64_t getLag() const {
+            return this->events->getHead() - this->position;
+        }
+};
+
+#endif
@@ -0,0 +1,214 @@
+// ==========================================
+// File:    MoveGenerator.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include "MoveGenerator.hpp"
+
+// Constructor:
+// ============
+// Takes the Position to generate moves for.
+MoveGenerator::MoveGenerator(const Position& position)
+    : position(position) {}
+
+// Private Method: generatePieceMoves
+// ==================================
+// Adds the moves of every Knight, Bishop, Rook, Queen and, unless
+// told otherwise, King of the side to move onto the given targets.
+void MoveGenerator::generatePieceMoves(MoveList& moves, Bitboard targets,
+                                       bool isKingIncluded) const {
+    Color us = this->position.getSideToMove();
+    Bitboard occupied = this->position.getPieces();
+
+    Bitboard pieces = this->position.getPieces(us, KnightType);
+    while (pieces) {
+        int from = popLsb(pieces);
+        Bitboard attacks = KNIGHT_ATTACKS[from] & targets;
+        while (attacks) moves.add(Move(from, popLsb(attacks)));
+    }
+
+    pieces = this->position.getPieces(us, BishopType);
+    while (pieces) {
+        int from = popLsb(pieces);
+        Bitboard attacks = bishopAttacks(from, occupied) & targets;
+        while (attacks) moves.add(Move(from, popLsb(attacks)));
+    }
+
+    pieces = this->position.getPieces(us, RookType);
+    while (pieces) {
+        int from = popLsb(pieces);
+        Bitboard attacks = rookAttacks(from, occupied) & targets;
+        while (attacks) moves.add(Move(from, popLsb(attacks)));
+    }
+
+    pieces = this->position.getPieces(us, QueenType);
+    while (pieces) {
+        int from = popLsb(pieces);
+        Bitboard attacks = queenAttacks(from, occupied) & targets;
+        while (attacks) moves.add(Move(from, popLsb(attacks)));
+    }
+
+    if (!isKingIncluded) return;
+    int from = this->position.getKingSquare(us);
+    Bitboard attacks = KING_ATTACKS[from] & targets;
+    while (attacks) moves.add(Move(from, popLsb(attacks)));
+}
+
+// Private Method: generatePawnCaptures
+// ====================================
+// Adds the captures of every Pawn of the side to move of the pieces
+// on the given target squares. They are found for all Pawns at once by
+// shifting the Pawn Bitboard towards each diagonal.
+void MoveGenerator::generatePawnCaptures(MoveList& moves,
+                                         Bitboard targets) const {
+    Color us = this->position.getSideToMove();
+    Bitboard enemies = this->position.getPieces(flip(us)) & targets;
+    Bitboard pawns = this->position.getPieces(us, PawnType);
+
+    // The two diagonals are left and right from White's point
+    // of view, and the edge files are masked to stop wrapping.
+    Bitboard left, right;
+    int leftOffset, rightOffset;
+    if (us == White) {
+        left = ((pawns & ~FILE_A_BITBOARD) << 7) & enemies;
+        right = ((pawns & ~FILE_H_BITBOARD) << 9) & enemies;
+        leftOffset = 7;
+        rightOffset = 9;
+    } else {
+        left = ((pawns & ~FILE_A_BITBOARD) >> 9) & enemies;
+        right = ((pawns & ~FILE_H_BITBOARD) >> 7) & enemies;
+        leftOffset = -9;
+        rightOffset = -7;
+    }
+    while (left) {
+        int to = popLsb(left);
+        moves.add(Move(to - leftOffset, to));
+    }
+    while (right) {
+        int to = popLsb(right);
+        moves.add(Move(to - rightOffset, to));
+    }
+}
+
+// Private Method: generatePawnPushes
+// ==================================
+// Adds the pushes of every Pawn of the side to move onto the given
+// target squares. A Pawn may push two squares from its starting rank
+// even if the square it passes is not a target, as long as it is empty.
+void MoveGenerator::generatePawnPushes(MoveList& moves,
+                                       Bitboard targets) const {
+    Color us = this->position.getSideToMove();
+    Bitboard empty = ~this->position.getPieces();
+    Bitboard pawns = this->position.getPieces(us, PawnType);
+
+    // Pawns push one square forward, and those that could push from
+    // their starting rank may push one more. Pawns on the last rank
+    // are shifted off the board, as they cannot move any further.
+    Bitboard single, twice;
+    int forward;
+    if (us == White) {
+        single = (pawns << SIDE_LEN) & empty;
+        twice = ((single & RANK_3_BITBOARD) << SIDE_LEN) & empty;
+        forward = SIDE_LEN;
+    } else {
+        single = (pawns >> SIDE_LEN) & empty;
+        twice = ((single & RANK_6_BITBOARD) >> SIDE_LEN) & empty;
+        forward = -SIDE_LEN;
+    }
+    single &= targets;
+    twice &= targets;
+    while (single) {
+        int to = popLsb(single);
+        moves.add(Move(to - forward, to));
+    }
+    while (twice) {
+        int to = popLsb(twice);
+        moves.add(Move(to - 2 * forward, to));
+    }
+}
+
+// Public Method: generateCaptures
+// ===============================
+// Adds every pseudo-legal capture.
+void MoveGenerator::generateCaptures(MoveList& moves) const {
+    Color us = this->position.getSideToMove();
+    Bitboard enemies = this->position.getPieces(flip(us));
+    this->generatePawnCaptures(moves, enemies);
+    this->generatePieceMoves(moves, enemies);
+}
+
+// Public Method: generateQuiets
+// =============================
+// Adds every pseudo-legal move that is not a capture.
+void MoveGenerator::generateQuiets(MoveList& moves) const {
+    Bitboard empty = ~this->position.getPieces();
+    this->generatePawnPushes(moves, empty);
+    this->generatePieceMoves(moves, empty);
+}
+
+// Public Method: generateAll
+// ==========================
+// Adds every pseudo-legal move, captures first.
+void MoveGenerator::generateAll(MoveList& moves) const {
+    this->generateCaptures(moves);
+    this->generateQuiets(moves);
+}
+
+// Public Method: generateLegal
+// ============================
+// Adds every legal move, captures first unless in check,
+// in which case only the evasions are generated.
+void MoveGenerator::generateLegal(MoveList& moves) const {
+    if (this->position.isInCheck(this->position.getSideToMove())) {
+        this->generateEvasions(moves);
+        return;
+    }
+    int first = moves.size();
+    this->generateAll(moves);
+    int legal = first;
+    for (int i = first; i < moves.size(); ++i) {
+        if (this->position.isLegal(moves[i])) moves[legal++] = moves[i];
+    }
+    moves.resize(legal);
+}
+
+// Public Method: generateEvasions
+// ===============================
+// Adds every legal move of a side to move that is in check. The King
+// may step to any square not attacked once it has left its own, so
+// that it cannot step back along the line of a slider. Under double
+// check that is all. Otherwise the checker may be captured, or its line
+// to the King blocked, by any piece that is not pinned to the King.
+void MoveGenerator::generateEvasions(MoveList& moves) const {
+    Color us = this->position.getSideToMove();
+    Color them = flip(us);
+    int kingSquare = this->position.getKingSquare(us);
+    Bitboard occupied = this->position.getPieces();
+    Bitboard enemies = this->position.getPieces(them);
+
+    Bitboard steps = KING_ATTACKS[kingSquare] & ~this->position.getPieces(us);
+    Bitboard withoutKing = occupied & ~squareBit(kingSquare);
+    while (steps) {
+        int to = popLsb(steps);
+        if (!(this->position.attackersTo(to, withoutKing) & enemies)) {
+            moves.add(Move(kingSquare, to));
+        }
+    }
+
+    Bitboard checkers = this->position.attackersTo(kingSquare, occupied) &
+                        enemies;
+    if (popCount(checkers) > 1) return;
+
+    int checker = lsb(checkers);
+    Bitboard blocks = BETWEEN[kingSquare][checker];
+    int first = moves.size();
+    this->generatePawnCaptures(moves, checkers);
+    this->generatePawnPushes(moves, blocks);
+    this->generatePieceMoves(moves, checkers | blocks, false);
+    int legal = first;
+    for (int i = first; i < moves.size(); ++i) {
+        if (this->position.isLegal(moves[i])) moves[legal++] = moves[i];
+    }
+    moves.resize(legal);
+}
@@ -0,0 +1,88 @@
+// ==========================================
+// File:    MoveGenerator.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef MOVE_GENERATOR_HPP
+#define MOVE_GENERATOR_HPP
+
+#include "Bitboard.hpp"
+#include "Position.hpp"
+#include "Move.hpp"
+
+// Class: MoveGenerator
+// ====================
+// This class generates the moves available to the side to move in a
+// Position. Moves are added at the end of a MoveList provided by the
+// caller, so one list can collect the moves of several generators
+// without anything being allocated. Apart from generateLegal, the moves
+// generated are pseudo-legal: they follow the rules of movement of
+// each piece but may leave the King in check, which is left for the
+// caller to test with Position::isLegal only when a move is tried.
+class MoveGenerator {
+
+    private:
+
+        const Position& position;
+
+        // Method: generatePieceMoves
+        // ==========================
+        // Adds the moves of every Knight, Bishop, Rook, Queen and,
+        // unless told otherwise, King of the side to move onto the
+        // given target squares.
+        void generatePieceMoves(MoveList& moves, Bitboard targets,
+                                bool isKingIncluded = true) const;
+
+        // Method: generatePawnCaptures
+        // ============================
+        // Adds the captures of every Pawn of the side to
+        // move of the pieces on the given target squares.
+        void generatePawnCaptures(MoveList& moves, Bitboard targets) const;
+
+        // Method: generatePawnPushes
+        // ==========================
+        // Adds the pushes of every Pawn of the side to move
+        // onto those of the given target squares that are empty.
+        void generatePawnPushes(MoveList& moves, Bitboard targets) const;
+
+    public:
+
+        // Constructor:
+        // ============
+        // Takes the Position to generate moves for.
+        MoveGenerator(const Position& position);
+
+        // Method: generateCaptures
+        // ========================
+        // Adds every pseudo-legal capture. This is the generator
+        // used by the quiescence search, so it only ever looks at
+        // the squares holding the opponent's pieces.
+        void generateCaptures(MoveList& moves) const;
+
+        // Method: generateQuiets
+        // ======================
+        // Adds every pseudo-legal move that is not a capture.
+        void generateQuiets(MoveList& moves) const;
+
+        // Method: generateAll
+        // ===================
+        // Adds every pseudo-legal move, captures first.
+        void generateAll(MoveList& moves) const;
+
+        // Method: generateLegal
+        // =====================
+        // Adds every legal move, captures first unless in check.
+        void generateLegal(MoveList& moves) const;
+
+        // Method: generateEvasions
+        // ========================
+        // Adds every legal move of a side to move that is in check:
+        // the King stepping to a square that is not attacked and, if
+        // there is a single checker, the captures of that checker and
+        // the moves blocking its line to the King. It must only be
+        // called when the side to move is in check.
+        void generateEvasions(MoveList& moves) const;
+};
+
+#endif
@@ -0,0 +1,157 @@
+// ==========================================
+// File:    MovePicker.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <algorithm>
+using namespace std;
+
+#include "MovePicker.hpp"
+#include "MoveGenerator.hpp"
+
+// Constructor:
+// ============
+// Takes the Position, the Move to try first (or the null Move), the
+// two killer moves of the current ply and the history table of the
+// side to move. A priority move that is not pseudo-legal in this
+// Position is dropped straight away.
+MovePicker::MovePicker(const Position& position, Move priorityMove,
+                       const Move* killers,
+                       const int history[NUM_SQUARES][NUM_SQUARES])
+    : position(position), priorityMove(priorityMove), history(history),
+      stage(PriorityStage), lastStage(PriorityStage), index(0),
+      killerIndex(0) {
+    this->killers[0] = killers[0];
+    this->killers[1] = killers[1];
+    if (priorityMove.isNull() || !position.isPseudoLegal(priorityMove)) {
+        this->priorityMove = Move();
+        this->stage = GenerateCapturesStage;
+    }
+}
+
+// Private Method: isSpecial
+// =========================
+// Returns true if the given Move is the priority move or one of
+// the killers, which are tried in their own stages.
+bool MovePicker::isSpecial(Move move) const {
+    return move == this->priorityMove || move == this->killers[0] ||
+           move == this->killers[1];
+}
+
+// Private Method: pickNext
+// ========================
+// Swaps the highest scoring of the remaining moves of the current
+// stage into place and returns it. As most nodes are cut off after
+// trying a few moves, picking moves one at a time is cheaper than
+// sorting all of them up front.
+Move MovePicker::pickNext() {
+    int best = this->index;
+    int count = this->moves.size();
+    for (int i = this->index + 1; i < count; ++i) {
+        if (this->scores[i] > this->scores[best]) best = i;
+    }
+    swap(this->moves[this->index], this->moves[best]);
+    swap(this->scores[this->index], this->scores[best]);
+    return this->moves[this->index++];
+}
+
+// Public Method: next
+// ===================
+// Returns the next pseudo-legal Move, or the null Move once every
+// move has been handed out. Each stage falls through to the next
+// one when it runs out of moves.
+Move MovePicker::next() {
+    MoveGenerator generator(this->position);
+    while (true) {
+        switch (this->stage) {
+
+            case PriorityStage:
+                this->stage = GenerateCapturesStage;
+                this->lastStage = PriorityStage;
+                return this->priorityMove;
+
+            case GenerateCapturesStage:
+                generator.generateCaptures(this->moves);
+                this->index = 0;
+                for (int i = 0; i < this->moves.size(); ++i) {
+                    Move move = this->moves[i];
+                    PieceType victim =
+                        typeOf(this->position.pieceOn(move.getTo()));
+                    PieceType attacker =
+                        typeOf(this->position.pieceOn(move.getFrom()));
+                    this->scores[i] = 8 * victim - attacker;
+                }
+                this->stage = GoodCapturesStage;
+                break;
+
+            case GoodCapturesStage:
+                while (this->index < this->moves.size()) {
+                    Move move = this->pickNext();
+                    if (move == this->priorityMove) continue;
+                    if (this->position.see(move) < 0) {
+                        this->badCaptures.add(move);
+                        continue;
+                    }
+                    this->lastStage = GoodCapturesStage;
+                    return move;
+                }
+                this->stage = KillersStage;
+                break;
+
+            // Killers come from sibling nodes, so they are only played
+            // if they are still legal and quiet in this Position.
+            case KillersStage:
+                while (this->killerIndex < 2) {
+                    Move move = this->killers[this->killerIndex++];
+                    if (move.isNull() || move == this->priorityMove) continue;
+                    if (this->killerIndex == 2 && move == this->killers[0]) {
+                        continue;
+                    }
+                    if (this->position.pieceOn(move.getTo()) != NO_PIECE) {
+                        continue;
+                    }
+                    if (!this->position.isPseudoLegal(move)) continue;
+                    this->lastStage = KillersStage;
+                    return move;
+                }
+                this->stage = GenerateQuietsStage;
+                break;
+
+            case GenerateQuietsStage:
+                this->moves.clear();
+                generator.generateQuiets(this->moves);
+                this->index = 0;
+                for (int i = 0; i < this->moves.size(); ++i) {
+                    Move move = this->moves[i];
+                    this->scores[i] =
+                        this->history[move.getFrom()][move.getTo()];
+                }
+                this->stage = QuietsStage;
+                break;
+
+            case QuietsStage:
+                while (this->index < this->moves.size()) {
+                    Move move = this->pickNext();
+                    if (this->isSpecial(move)) continue;
+                    this->lastStage = QuietsStage;
+                    return move;
+                }
+                this->index = 0;
+                this->stage = BadCapturesStage;
+                break;
+
+            case BadCapturesStage:
+                if (this->index < this->badCaptures.size()) {
+                    this->lastStage = BadCapturesStage;
+                    return this->badCaptures[this->index++];
+                }
+                this->stage = DoneStage;
+                break;
+
+            case DoneStage:
+                this->lastStage = DoneStage;
+                return Move();
+        }
+    }
+}
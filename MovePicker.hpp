@@ -0,0 +1,85 @@
+// ==========================================
+// File:    MovePicker.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef MOVE_PICKER_HPP
+#define MOVE_PICKER_HPP
+
+#include "Position.hpp"
+#include "Move.hpp"
+
+// Enum: MoveStage
+// ===============
+// The stages a MovePicker goes through, in order. Moves are only
+// generated when the stage that needs them is reached, so a node that
+// is cut off by its first few moves never generates the quiet moves.
+enum MoveStage {PriorityStage, GenerateCapturesStage, GoodCapturesStage,
+                KillersStage, GenerateQuietsStage, QuietsStage,
+                BadCapturesStage, DoneStage};
+
+// Class: MovePicker
+// =================
+// This class hands out the pseudo-legal moves of a Position one at a
+// time, in the order the Search is most likely to find a cut-off with:
+// first the priority move (the best move of the previous iteration at
+// the root), then captures that do not lose material according to the
+// static exchange evaluation, most valuable victim first, then the
+// killer moves of the current ply, then the other quiet moves ordered
+// by their history score and finally the captures that lose material.
+// The Search uses the stage a move came from to decide how much to
+// trust it, e.g. late quiet moves are searched to a reduced depth.
+class MovePicker {
+
+    private:
+
+        const Position& position;       // Position to pick moves for.
+        Move priorityMove;              // Move to try first, if any.
+        Move killers[2];                // Killer moves of this ply.
+        const int (*history)[NUM_SQUARES];  // History scores by squares.
+        MoveStage stage;                // Stage of the next move.
+        MoveStage lastStage;            // Stage of the last move.
+
+        MoveList moves;                 // Moves of the current stage.
+        int scores[MAX_MOVES];          // Scores of those moves.
+        int index;                      // Index of the next move.
+        MoveList badCaptures;           // Captures losing material.
+        int killerIndex;                // Index of the next killer.
+
+        // Method: isSpecial
+        // =================
+        // Returns true if the given Move is the priority move or one
+        // of the killers, which are tried in their own stages.
+        bool isSpecial(Move move) const;
+
+        // Method: pickNext
+        // ================
+        // Swaps the highest scoring of the remaining moves of
+        // the current stage into place and returns it.
+        Move pickNext();
+
+    public:
+
+        // Constructor:
+        // ============
+        // Takes the Position, the Move to try first (or the null Move),
+        // the two killer moves of the current ply and the history
+        // table of the side to move, indexed by source and destination.
+        MovePicker(const Position& position, Move priorityMove,
+                   const Move* killers,
+                   const int history[NUM_SQUARES][NUM_SQUARES]);
+
+        // Method: next
+        // ============
+        // Returns the next pseudo-legal Move, or the null
+        // Move once every move has been handed out.
+        Move next();
+
+        // Method: getStage
+        // ================
+        // Returns the stage the last Move handed out came from.
+        MoveStage getStage() const { return this->lastStage; }
+};
+
+#endif
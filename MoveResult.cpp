@@ -0,0 +1,137 @@
+// ==========================================
+// File:    MoveResult.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <string>
+using namespace std;
+
+#include "MoveResult.hpp"
+#include "Bitboard.hpp"
+#include "Settings.hpp"
+
+// Function: printSquare
+// =====================
+// Outputs the square with the given index as a file followed by a
+// rank (e.g. A1), as a ChessSquare would be.
+static ostream& printSquare(ostream& os, int square) {
+    os << squareFile(square) << squareRank(square);
+    return os;
+}
+
+// Function: checkSource
+// =====================
+// Takes a Position, the index of a source square and a MoveResult, and
+// fills in the source square, piece and Color of the MoveResult. Returns
+// false, setting its status, if the square is empty or holds a piece of
+// the player whose turn it is not to play.
+bool checkSource(const Position& position, int square, MoveResult& result) {
+    result.from = static_cast<unsigned char>(square);
+    Piece piece = position.pieceOn(square);
+    if (piece == NO_PIECE) {
+        result.status = NoPieceStatus;
+        return false;
+    }
+
+    result.color = colorOf(piece);
+    result.moved = typeOf(piece);
+    if (result.color != position.getSideToMove()) {
+        result.status = WrongTurnStatus;
+        return false;
+    }
+    return true;
+}
+
+// Function: playMove
+// ==================
+// Takes a Position of a game that is not over and a Move, and plays the
+// Move on the Position if it follows the rules of movement for its piece
+// and does not leave its King in check. If the opponent then cannot
+// move, the game has ended in checkmate if it is in check and in
+// stalemate otherwise.
+MoveResult playMove(Position& position, Move move, int hintSquare) {
+    MoveResult result;
+    result.to = static_cast<unsigned char>(move.getTo());
+    if (!checkSource(position, move.getFrom(), result)) return result;
+
+    if (!position.isPseudoLegal(move) || !position.isLegal(move)) {
+        result.status = IllegalMoveStatus;
+        return result;
+    }
+    result.status = PlayedStatus;
+    result.captured = typeOf(position.pieceOn(move.getTo()));
+
+    UndoInfo undo;
+    position.makeMove(move, undo);
+    result.isCheck = position.isInCheck(position.getSideToMove());
+    if (!hasLegalMove(position, hintSquare)) {
+        result.isCheckmate = result.isCheck;
+        result.isStalemate = !result.isCheck;
+        result.termination = result.isCheck ? CheckmateTermination
+                                            : StalemateTermination;
+    }
+    return result;
+}
+
+// Operator: <<
+// ============
+// Outputs the message describing a MoveResult to the client. A move
+// that checks or ends the game is followed by a line saying so. Lines
+// are ended with newlines rather than endl, so that nothing is flushed.
+ostream& operator<<(ostream& os, const MoveResult& result) {
+    switch (result.status) {
+        case GameOverStatus:
+            os << "Game is over. No more moves are allowed.";
+            return os;
+        case NoGameStatus:
+            os << "There is no such game!";
+            return os;
+        case NoPieceStatus:
+            os << "There is no piece at position ";
+            printSquare(os, result.from) << "!";
+            return os;
+        case WrongTurnStatus:
+            os << "It is not " << result.color << "'s turn to move!";
+            return os;
+        case IllegalMoveStatus:
+            os << result.color << "'s "
+               << getDescriptor(result.color, result.moved).name
+               << " cannot move to ";
+            printSquare(os, result.to) << "!";
+            return os;
+        case PlayedStatus:
+            break;
+    }
+
+    os << result.color << "'s "
+       << getDescriptor(result.color, result.moved).name << " moves from ";
+    printSquare(os, result.from) << " to ";
+    printSquare(os, result.to);
+    if (result.captured != NoPieceType) {
+        os << " taking " << !result.color << "'s "
+           << getDescriptor(!result.color, result.captured).name;
+    }
+    if (result.isCheck) {
+        os << '\n' << !result.color << " is in check";
+        if (result.isCheckmate) os << "mate";
+    } else if (result.isStalemate) {
+        os << '\n' << !result.color << " cannot move. Stalemate!\n";
+    }
+    switch (result.termination) {
+        case RepetitionTermination:
+            os << "\nThe same position has occurred " << REPETITION_LIMIT
+               << " times. Draw!";
+            break;
+        case FiftyMoveTermination:
+            os << "\nNo capture or Pawn move in " << FIFTY_MOVE_PLIES / 2
+               << " moves. Draw!";
+            break;
+        case InsufficientMaterialTermination:
+            os << "\nNeither side can checkmate. Draw!";
+            break;
+        default:
+            break;
+    }
+    return os;
+}
@@ -0,0 +1,102 @@
+// ==========================================
+// File:    MoveResult.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef MOVE_RESULT_HPP
+#define MOVE_RESULT_HPP
+
+#include <iostream>
+using namespace std;
+
+#include "ChessPiece.hpp"
+#include "Position.hpp"
+#include "Move.hpp"
+#include "Termination.hpp"
+
+// Enum: MoveStatus
+// ================
+// Whether a move submitted to the ChessBoard was played and, if it
+// was not, why it was rejected.
+enum MoveStatus {PlayedStatus, GameOverStatus, NoPieceStatus,
+                 WrongTurnStatus, IllegalMoveStatus, NoGameStatus};
+
+// Struct: MoveResult
+// ==================
+// Describes the outcome of a move submitted to the ChessBoard without
+// formatting anything, so that checking a move costs no more than the
+// validation itself. The message the client would be shown is only
+// rendered when a MoveResult is inserted into a stream. Squares are
+// given by index, A1 being 0 and H8 being 63.
+struct MoveResult {
+    MoveStatus status;      // Whether the move was played.
+    Color color;            // Color of the piece on the source square.
+    PieceType moved;        // Type of that piece, if any.
+    PieceType captured;     // Type of the piece captured, if any.
+    unsigned char from;     // Index of the source square.
+    unsigned char to;       // Index of the destination square.
+    bool isCheck;           // Whether the opponent is now in check.
+    bool isCheckmate;       // Whether the opponent is checkmated.
+    bool isStalemate;       // Whether the opponent cannot move.
+    Termination termination; // How the game ended, if it did.
+
+    MoveResult()
+        : status(GameOverStatus), color(White), moved(NoPieceType),
+          captured(NoPieceType), from(0), to(0), isCheck(false),
+          isCheckmate(false), isStalemate(false),
+          termination(NoTermination) {}
+
+    // Method: isPlayed
+    // ================
+    // Returns true if the move was played.
+    bool isPlayed() const { return this->status == PlayedStatus; }
+
+    // Method: isCapture
+    // =================
+    // Returns true if the move was played and captured a piece.
+    bool isCapture() const {
+        return this->isPlayed() && this->captured != NoPieceType;
+    }
+
+    // Method: isGameOver
+    // ==================
+    // Returns true if the move was played and ended the game.
+    bool isGameOver() const {
+        return this->termination != NoTermination;
+    }
+
+    // Method: isDraw
+    // ==============
+    // Returns true if the move was played and drew the game.
+    bool isDraw() const {
+        return this->isGameOver() &&
+               this->termination != CheckmateTermination;
+    }
+};
+
+// Function: checkSource
+// =====================
+// Takes a Position, the index of a source square and a MoveResult, and
+// fills in the source square, piece and Color of the MoveResult. Returns
+// false, setting its status, if the square is empty or holds a piece of
+// the player whose turn it is not to play.
+bool checkSource(const Position& position, int square, MoveResult& result);
+
+// Function: playMove
+// ==================
+// Takes a Position of a game that is not over and a Move, and plays the
+// Move on the Position if it is valid. Returns a MoveResult describing
+// the outcome, which tells whether the game has now ended in checkmate
+// or stalemate. The hint square is passed on to hasLegalMove to look
+// for a move of the opponent. Draw rules are left to the caller.
+MoveResult playMove(Position& position, Move move,
+                    int hintSquare = NO_SQUARE);
+
+// Operator: <<
+// ============
+// Outputs the message describing a MoveResult to the client,
+// the same that ChessBoard::submitMove prints for it.
+ostream& operator<<(ostream& os, const MoveResult& result);
+
+#endif
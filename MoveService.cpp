@@ -0,0 +1,269 @@
+// ==========================================
+// File:    MoveService.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <chrono>
+#include <stdexcept>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+using namespace std;
+
+#include "MoveService.hpp"
+#include "Settings.hpp"
+
+// Constructor:
+// ============
+// Takes the number of workers and the number of games each of them
+// can host, allocates the games of every worker and starts them. The
+// slot indices of all the games must fit in the low 32 bits of a GameId.
+// Throws an invalid_argument exception if there is not a single worker.
+MoveService::MoveService(int shardCount, size_t gamesPerShard)
+    : nextWorker(0), isStopping(false) {
+    if (shardCount < 1) {
+        throw invalid_argument("MoveService needs at least one worker");
+    }
+    for (int i = 0; i < shardCount; ++i) {
+        this->workers.emplace_back(new ServiceWorker(gamesPerShard));
+    }
+    unsigned int cores = thread::hardware_concurrency();
+    for (int i = 0; i < shardCount; ++i) {
+        ServiceWorker& worker = *this->workers[i];
+        worker.runner = thread(&MoveService::runWorker, this, i);
+#ifdef __linux__
+        if (cores > 0) {
+            cpu_set_t cpus;
+            CPU_ZERO(&cpus);
+            CPU_SET(i % cores, &cpus);
+            pthread_setaffinity_np(worker.runner.native_handle(),
+                                   sizeof(cpus), &cpus);
+        }
+#endif
+    }
+}
+
+// Destructor:
+// ===========
+// Tells the workers to stop once their queues are empty and waits
+// for each of them to finish.
+MoveService::~MoveService() {
+    this->isStopping = true;
+    for (size_t i = 0; i < this->workers.size(); ++i) {
+        ServiceWorker& worker = *this->workers[i];
+        {
+            lock_guard<mutex> guard(worker.sleepLock);
+            worker.wakeUp.notify_one();
+        }
+        worker.runner.join();
+    }
+}
+
+// Private Method: toServiceId
+// ===========================
+// Takes the GameId a worker knows a game by and the index of the
+// worker, and interleaves the slot indices of all the workers.
+GameId MoveService::toServiceId(GameId gameId, int shard) const {
+    if (gameId == NO_GAME) return NO_GAME;
+    GameId slot = static_cast<uint32_t>(gameId);
+    GameId generation = gameId >> 32;
+    return (generation << 32) | (slot * this->workers.size() + shard);
+}
+
+// Private Method: toWorkerId
+// ==========================
+// Takes the GameId clients know a game by and returns the GameId
+// its worker knows it by.
+GameId MoveService::toWorkerId(GameId gameId) const {
+    GameId slot = static_cast<uint32_t>(gameId);
+    GameId generation = gameId >> 32;
+    return (generation << 32) | (slot / this->workers.size());
+}
+
+// Private Method: getShard
+// ========================
+// Takes the GameId clients know a game by and returns the index of
+// the worker owning it.
+int MoveService::getShard(GameId gameId) const {
+    return static_cast<int>(static_cast<uint32_t>(gameId) %
+                            this->workers.size());
+}
+
+// Private Method: send
+// ====================
+// Takes the index of a worker and a request and puts the request on
+// the worker's queue. The worker only sleeps after it has found its
+// queue empty, so it is woken up if it was found asleep after the
+// request was pushed. The fence pairs with the one in runWorker: either
+// the worker sees the request or this thread sees the worker asleep,
+// even where stores may be reordered after later loads.
+void MoveService::send(int shard, ServiceRequest&& request) {
+    ServiceWorker& worker = *this->workers[shard];
+    while (!worker.queue.tryPush(move(request))) {
+        this_thread::yield();
+    }
+    atomic_thread_fence(memory_order_seq_cst);
+    if (worker.isSleeping) {
+        lock_guard<mutex> guard(worker.sleepLock);
+        worker.wakeUp.notify_one();
+    }
+}
+
+// Private Method: runWorker
+// =========================
+// Runs on the thread of the worker with the given index. An idle
+// worker keeps polling its queue for a while, so that requests that
+// arrive in quick succession are picked up without a context switch,
+// and then sleeps until it is woken up or a timeout expires.
+void MoveService::runWorker(int shard) {
+    ServiceWorker& worker = *this->workers[shard];
+    ServiceRequest batch[SERVICE_BATCH_SIZE];
+    int idleCount = 0;
+    while (true) {
+        int count = 0;
+        while (count < SERVICE_BATCH_SIZE &&
+               worker.queue.tryPop(batch[count])) {
+            ++count;
+        }
+
+        if (count > 0) {
+            this->handleBatch(shard, batch, count);
+            idleCount = 0;
+            continue;
+        }
+
+        if (this->isStopping) break;
+        if (++idleCount < SERVICE_SPIN_COUNT) {
+            this_thread::yield();
+            continue;
+        }
+
+        unique_lock<mutex> lock(worker.sleepLock);
+        worker.isSleeping = true;
+        atomic_thread_fence(memory_order_seq_cst);
+        if (worker.queue.getSize() == 0 && !this->isStopping) {
+            worker.wakeUp.wait_for(lock, chrono::microseconds(
+                                             SERVICE_SLEEP_MICROSECONDS));
+        }
+        worker.isSleeping = false;
+        idleCount = 0;
+    }
+}
+
+// Private Method: handleBatch
+// ===========================
+// Takes the index of a worker and a batch of its requests and handles
+// them. The batch is first sorted by game with an insertion sort, which
+// is stable and cheap for a batch this small, so that each game is
+// loaded into the cache once per batch and its moves are still played
+// in the order they were sent.
+void MoveService::handleBatch(int shard, ServiceRequest* batch,
+                              int count) {
+    ServiceWorker& worker = *this->workers[shard];
+    int order[SERVICE_BATCH_SIZE];
+    for (int i = 0; i < count; ++i) {
+        int j = i;
+        while (j > 0 && batch[order[j - 1]].gameId > batch[i].gameId) {
+            order[j] = order[j - 1];
+            --j;
+        }
+        order[j] = i;
+    }
+
+    for (int i = 0; i < count; ++i) {
+        ServiceRequest& request = batch[order[i]];
+        switch (request.type) {
+            case CreateGameRequest: {
+                GameId gameId = worker.sessions.createGame();
+                request.createdGame->set_value(
+                    this->toServiceId(gameId, shard));
+                break;
+            }
+            case SubmitMoveRequest:
+                request.moveResult->set_value(
+                    worker.sessions.submitMove(request.gameId,
+                                               request.move));
+                break;
+            case EndGameRequest:
+                worker.sessions.endGame(request.gameId);
+                break;
+        }
+        request.createdGame.reset();
+        request.moveResult.reset();
+    }
+    worker.processed.fetch_add(count, memory_order_relaxed);
+    worker.batches.fetch_add(1, memory_order_relaxed);
+}
+
+// Public Method: createGame
+// =========================
+// Starts a new game on the next worker in turn, so that
+// games are spread evenly across the workers.
+future<GameId> MoveService::createGame() {
+    int shard = static_cast<int>(this->nextWorker++ % this->workers.size());
+    ServiceRequest request;
+    request.type = CreateGameRequest;
+    request.gameId = NO_GAME;
+    request.createdGame.emplace();
+    future<GameId> result = request.createdGame->get_future();
+    this->send(shard, move(request));
+    return result;
+}
+
+// Public Method: submitMove
+// =========================
+// Takes a GameId and a Move and sends the Move to the worker owning
+// that game.
+future<MoveResult> MoveService::submitMove(GameId gameId, Move move) {
+    ServiceRequest request;
+    request.type = SubmitMoveRequest;
+    request.gameId = this->toWorkerId(gameId);
+    request.move = move;
+    request.moveResult.emplace();
+    future<MoveResult> result = request.moveResult->get_future();
+    this->send(this->getShard(gameId), std::move(request));
+    return result;
+}
+
+// Public Method: endGame
+// ======================
+// Takes a GameId and tells the worker owning that game to end it.
+void MoveService::endGame(GameId gameId) {
+    ServiceRequest request;
+    request.type = EndGameRequest;
+    request.gameId = this->toWorkerId(gameId);
+    this->send(this->getShard(gameId), move(request));
+}
+
+// Public Method: getShardCount
+// ============================
+// Returns the number of workers.
+int MoveService::getShardCount() const {
+    return static_cast<int>(this->workers.size());
+}
+
+// Public Method: getQueueDepth
+// ============================
+// Returns roughly how many requests wait in the queue of the worker
+// with the given index.
+size_t MoveService::getQueueDepth(int shard) const {
+    return this->workers[shard]->queue.getSize();
+}
+
+// Public Method: getProcessedCount
+// ================================
+// Returns how many requests the worker with the given index has
+// handled so far.
+unsigned long long MoveService::getProcessedCount(int shard) const {
+    return this->workers[shard]->processed.load(memory_order_relaxed);
+}
+
+// Public Method: getBatchCount
+// ============================
+// Returns in how many batches the worker with the given index has
+// handled them.
+unsigned long long MoveService::getBatchCount(int shard) const {
+    return this->workers[shard]->batches.load(memory_order_relaxed);
+}
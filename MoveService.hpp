@@ -0,0 +1,187 @@
+// ==========================================
+// File:    MoveService.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef MOVE_SERVICE_HPP
+#define MOVE_SERVICE_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+using namespace std;
+
+#include "MpscQueue.hpp"
+#include "SessionManager.hpp"
+#include "MoveResult.hpp"
+#include "Move.hpp"
+
+// Enum: RequestType
+// =================
+// What a request sent to a worker of a MoveService asks it to do.
+enum RequestType {CreateGameRequest, SubmitMoveRequest, EndGameRequest};
+
+// Struct: ServiceRequest
+// ======================
+// A request sent to a worker of a MoveService, along with the promise
+// through which the worker answers it, if any. The GameId is the one
+// the worker's SessionManager knows the game by.
+struct ServiceRequest {
+    RequestType type;                           // What to do.
+    GameId gameId;                              // Game to do it in.
+    Move move;                                  // Move to submit.
+    optional<promise<GameId>> createdGame;      // Answer to a creation.
+    optional<promise<MoveResult>> moveResult;   // Answer to a move.
+};
+
+// Struct: ServiceWorker
+// =====================
+// A worker thread of a MoveService together with the games it owns
+// and the queue its requests arrive on. Only the worker ever touches
+// its SessionManager, so the games need no locks.
+struct ServiceWorker {
+    SessionManager sessions;            // Games owned by this worker.
+    MpscQueue<ServiceRequest> queue;    // Requests for those games.
+    thread runner;                      // Thread running the worker.
+    atomic<bool> isSleeping;            // Whether it waits for requests.
+    mutex sleepLock;                    // Guards the wake-up below.
+    condition_variable wakeUp;          // Signalled on new requests.
+    atomic<unsigned long long> processed;   // Requests handled so far.
+    atomic<unsigned long long> batches;     // Batches handled so far.
+
+    ServiceWorker(size_t capacity)
+        : sessions(capacity), queue(SERVICE_QUEUE_SIZE), isSleeping(false),
+          processed(0), batches(0) {}
+};
+
+// Class: MoveService
+// ==================
+// This class lets any number of threads play moves in many games at
+// once. Games are sharded across worker threads, one per core, and each
+// game is owned by exactly one worker, so its state stays in that core's
+// cache and is never locked. Requests reach a worker through a lock-free
+// queue that the worker drains in batches, handling the requests of a
+// batch game by game. Each request is answered through a future, so a
+// client may submit moves and wait for their results when it needs them.
+//
+// The GameId of a game hosted by a MoveService names the worker owning
+// it: its slot index modulo the number of workers is that worker's
+// index, and the quotient is the slot index within the worker.
+class MoveService {
+
+    private:
+
+        vector<unique_ptr<ServiceWorker>> workers;  // One per shard.
+        atomic<unsigned int> nextWorker;    // Worker for the next game.
+        atomic<bool> isStopping;            // Set to stop the workers.
+
+        // Method: toServiceId
+        // ===================
+        // Takes the GameId a worker knows a game by and the index of the
+        // worker, and returns the GameId clients know the game by.
+        GameId toServiceId(GameId gameId, int shard) const;
+
+        // Method: toWorkerId
+        // ==================
+        // Takes the GameId clients know a game by and returns the GameId
+        // its worker knows it by.
+        GameId toWorkerId(GameId gameId) const;
+
+        // Method: getShard
+        // ================
+        // Takes the GameId clients know a game by and returns the index
+        // of the worker owning it.
+        int getShard(GameId gameId) const;
+
+        // Method: send
+        // ============
+        // Takes the index of a worker and a request and puts the request
+        // on the worker's queue, waking the worker up if it sleeps. If
+        // the queue is full, it waits for the worker to make room.
+        void send(int shard, ServiceRequest&& request);
+
+        // Method: runWorker
+        // =================
+        // Runs on the thread of the worker with the given index. Takes
+        // batches of requests off its queue and handles them, and sleeps
+        // when there are none, until the MoveService is destroyed.
+        void runWorker(int shard);
+
+        // Method: handleBatch
+        // ===================
+        // Takes the index of a worker and a batch of its requests and
+        // handles them, grouping the requests of each game together
+        // while keeping them in the order they were sent.
+        void handleBatch(int shard, ServiceRequest* batch, int count);
+
+        // Copying would copy the worker threads.
+        MoveService(const MoveService& other);
+        MoveService& operator=(const MoveService& other);
+
+    public:
+
+        // Constructor:
+        // ============
+        // Takes the number of workers and the number of games each of
+        // them can host, and starts the workers. Each worker is pinned
+        // to a core of its own where the platform allows it. Throws an
+        // invalid_argument exception if shardCount is less than one.
+        MoveService(int shardCount, size_t gamesPerShard);
+
+        // Destructor:
+        // ===========
+        // Lets the workers handle the requests already sent, then
+        // stops them. No request may be sent while it runs.
+        virtual ~MoveService();
+
+        // Method: createGame
+        // ==================
+        // Starts a new game from the initial position on the next worker
+        // in turn. The future holds its GameId, or NO_GAME if that
+        // worker has no free slot.
+        future<GameId> createGame();
+
+        // Method: submitMove
+        // ==================
+        // Takes a GameId and a Move and sends the Move to the worker
+        // owning that game. The future holds the MoveResult, with
+        // NoGameStatus if there is no such game.
+        future<MoveResult> submitMove(GameId gameId, Move move);
+
+        // Method: endGame
+        // ===============
+        // Takes a GameId and tells the worker owning that game to end it
+        // and free its slot. Moves sent for it afterwards are rejected.
+        void endGame(GameId gameId);
+
+        // Method: getShardCount
+        // =====================
+        // Returns the number of workers.
+        int getShardCount() const;
+
+        // Method: getQueueDepth
+        // =====================
+        // Returns roughly how many requests wait in the queue of the
+        // worker with the given index.
+        size_t getQueueDepth(int shard) const;
+
+        // Method: getProcessedCount
+        // =========================
+        // Returns how many requests the worker with the given
+        // index has handled so far.
+        unsigned long long getProcessedCount(int shard) const;
+
+        // Method: getBatchCount
+        // =====================
+        // Returns in how many batches the worker with the given
+        // index has handled them.
+        unsigned long long getBatchCount(int shard) const;
+};
+
+#endif
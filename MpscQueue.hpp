@@ -0,0 +1,133 @@
+// ==========================================
+// File:    MpscQueue.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef MPSC_QUEUE_HPP
+#define MPSC_QUEUE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+using namespace std;
+
+#include "Settings.hpp"
+
+// Class: MpscQueue
+// ================
+// This class is a bounded queue that any number of threads may push to
+// and a single thread pops from, without locks. Values are kept in a
+// ring of cells, each with a sequence number telling whether it is
+// ready to be written or read in the current lap of the ring. Producers
+// claim a cell by advancing the push position with a compare-and-swap
+// and then publish the value by bumping the cell's sequence number, so
+// that the consumer only ever reads fully written values. The capacity
+// must be a power of 2. The queue never allocates once constructed.
+template <typename T>
+class MpscQueue {
+
+    private:
+
+        // Struct: Cell
+        // ============
+        // A slot of the ring and the sequence number guarding it.
+        struct Cell {
+            atomic<size_t> sequence;
+            T value;
+        };
+
+        vector<Cell> cells;                 // The ring of cells.
+        size_t mask;                        // Capacity minus one.
+        alignas(CACHE_LINE_SIZE) atomic<size_t> pushPosition;
+        alignas(CACHE_LINE_SIZE) atomic<size_t> popPosition;
+
+        // Copying would copy the values of a live queue.
+        MpscQueue(const MpscQueue& other);
+        MpscQueue& operator=(const MpscQueue& other);
+
+    public:
+
+        // Constructor:
+        // ============
+        // Takes the capacity of the queue, which must be a power of 2.
+        MpscQueue(size_t capacity)
+            : cells(capacity), mask(capacity - 1),
+              pushPosition(0), popPosition(0) {
+            for (size_t i = 0; i < capacity; ++i) {
+                this->cells[i].sequence.store(i, memory_order_relaxed);
+            }
+        }
+
+        // Method: tryPush
+        // ===============
+        // Takes a value and moves it onto the back of the queue. May be
+        // called from any thread. Returns false if the queue is full.
+        bool tryPush(T&& value) {
+            size_t position = this->pushPosition.load(memory_order_relaxed);
+            while (true) {
+                Cell& cell = this->cells[position & this->mask];
+                size_t sequence = cell.sequence.load(memory_order_acquire);
+                ptrdiff_t lap = static_cast<ptrdiff_t>(sequence) -
+                                static_cast<ptrdiff_t>(position);
+                if (lap == 0) {
+
+                    // The cell is free in this lap: try to claim it.
+                    if (this->pushPosition.compare_exchange_weak(
+                            position, position + 1, memory_order_relaxed)) {
+                        cell.value = move(value);
+                        cell.sequence.store(position + 1,
+                                            memory_order_release);
+                        return true;
+                    }
+                } else if (lap < 0) {
+
+                    // The cell still holds a value from the last lap.
+                    return false;
+                } else {
+
+                    // Another producer claimed the cell first.
+                    position = this->pushPosition.load(memory_order_relaxed);
+                }
+            }
+        }
+
+        // Method: tryPop
+        // ==============
+        // Moves the value at the front of the queue into the given
+        // variable. Must only be called from the consumer thread.
+        // Returns false if the queue is empty.
+        bool tryPop(T& value) {
+            size_t position = this->popPosition.load(memory_order_relaxed);
+            Cell& cell = this->cells[position & this->mask];
+            size_t sequence = cell.sequence.load(memory_order_acquire);
+            if (sequence != position + 1) return false;
+
+            value = move(cell.value);
+            cell.sequence.store(position + this->mask + 1,
+                                memory_order_release);
+            this->popPosition.store(position + 1, memory_order_relaxed);
+            return true;
+        }
+
+        // Method: getSize
+        // ===============
+        // Returns the number of values in the queue. As other threads
+        // may push or pop meanwhile, this is only an estimate.
+        size_t getSize() const {
+            size_t pushed = this->pushPosition.load(memory_order_relaxed);
+            size_t popped = this->popPosition.load(memory_order_relaxed);
+            return (pushed > popped) ? pushed - popped : 0;
+        }
+
+        // Method: getCapacity
+        // ===================
+        // Returns the number of values the queue can hold.
+        size_t getCapacity() const {
+            return this->mask + 1;
+        }
+};
+
+#endif
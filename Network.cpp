@@ -0,0 +1,431 @@
+// ==========================================
+// File:    Network.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <algorithm>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+using namespace std;
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define NETWORK_X86
+#endif
+
+#include "Network.hpp"
+
+// Constants: Quantisation
+// =======================
+// Outputs of the dense layers are shifted right by WEIGHT_SHIFT before
+// being clipped to [0, ACTIVATION_MAX], and the output of the last
+// layer is divided by OUTPUT_SCALE to turn it into centipawns.
+const int WEIGHT_SHIFT = 6;
+const int ACTIVATION_MAX = 127;
+const int OUTPUT_SCALE = 16;
+const char NETWORK_MAGIC[8] = {'C', 'H', 'E', 'S', 'S', 'N', 'N', '1'};
+
+// Types: Kernels
+// ==============
+// A RowKernel adds or subtracts a row of weights to an accumulator.
+// An AffineKernel computes output = biases + weights * input for a
+// dense layer whose weights are stored one output row at a time.
+typedef void (*RowKernel)(int16_t* accumulator, const int16_t* row);
+typedef void (*AffineKernel)(const uint8_t* input, int inputSize,
+                             const int8_t* weights, const int32_t* biases,
+                             int32_t* output, int outputSize);
+
+// Scalar Kernels
+// ==============
+// These run on any CPU and define what the SIMD kernels compute.
+static void addRowScalar(int16_t* accumulator, const int16_t* row) {
+    for (int i = 0; i < NETWORK_HIDDEN; ++i) accumulator[i] += row[i];
+}
+
+static void subtractRowScalar(int16_t* accumulator, const int16_t* row) {
+    for (int i = 0; i < NETWORK_HIDDEN; ++i) accumulator[i] -= row[i];
+}
+
+static void affineScalar(const uint8_t* input, int inputSize,
+                         const int8_t* weights, const int32_t* biases,
+                         int32_t* output, int outputSize) {
+    for (int o = 0; o < outputSize; ++o) {
+        const int8_t* row = weights + o * inputSize;
+        int32_t sum = biases[o];
+        for (int i = 0; i < inputSize; ++i) sum += input[i] * row[i];
+        output[o] = sum;
+    }
+}
+
+#ifdef NETWORK_X86
+
+// AVX2 Kernels
+// ============
+// Dense layers multiply 32 pairs of unsigned inputs and signed weights
+// at a time. Inputs never exceed ACTIVATION_MAX, so the 16-bit sums of
+// adjacent products produced by maddubs cannot saturate.
+__attribute__((target("avx2")))
+static void addRowAvx2(int16_t* accumulator, const int16_t* row) {
+    for (int i = 0; i < NETWORK_HIDDEN; i += 16) {
+        __m256i* a = reinterpret_cast<__m256i*>(accumulator + i);
+        __m256i r = _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i*>(row + i));
+        _mm256_storeu_si256(a, _mm256_add_epi16(_mm256_loadu_si256(a), r));
+    }
+}
+
+__attribute__((target("avx2")))
+static void subtractRowAvx2(int16_t* accumulator, const int16_t* row) {
+    for (int i = 0; i < NETWORK_HIDDEN; i += 16) {
+        __m256i* a = reinterpret_cast<__m256i*>(accumulator + i);
+        __m256i r = _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i*>(row + i));
+        _mm256_storeu_si256(a, _mm256_sub_epi16(_mm256_loadu_si256(a), r));
+    }
+}
+
+__attribute__((target("avx2")))
+static int32_t horizontalSumAvx2(__m256i sum) {
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(sum),
+                              _mm256_extracti128_si256(sum, 1));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0x4E));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, 0xB1));
+    return _mm_cvtsi128_si32(s);
+}
+
+__attribute__((target("avx2")))
+static void affineAvx2(const uint8_t* input, int inputSize,
+                       const int8_t* weights, const int32_t* biases,
+                       int32_t* output, int outputSize) {
+    const __m256i ones = _mm256_set1_epi16(1);
+    for (int o = 0; o < outputSize; ++o) {
+        const int8_t* row = weights + o * inputSize;
+        __m256i sum = _mm256_setzero_si256();
+        for (int i = 0; i < inputSize; i += 32) {
+            __m256i in = _mm256_loadu_si256(
+                             reinterpret_cast<const __m256i*>(input + i));
+            __m256i w = _mm256_loadu_si256(
+                            reinterpret_cast<const __m256i*>(row + i));
+            __m256i products = _mm256_maddubs_epi16(in, w);
+            sum = _mm256_add_epi32(sum, _mm256_madd_epi16(products, ones));
+        }
+        output[o] = biases[o] + horizontalSumAvx2(sum);
+    }
+}
+
+// AVX-512 VNNI Kernels
+// ====================
+// VNNI multiplies and sums groups of four input and weight bytes
+// straight into 32-bit lanes, 64 bytes at a time. Layers with 32
+// inputs fall back to the 256-bit form of the same instruction.
+__attribute__((target("avx512f,avx512bw")))
+static void addRowAvx512(int16_t* accumulator, const int16_t* row) {
+    for (int i = 0; i < NETWORK_HIDDEN; i += 32) {
+        __m512i a = _mm512_loadu_si512(accumulator + i);
+        __m512i r = _mm512_loadu_si512(row + i);
+        _mm512_storeu_si512(accumulator + i, _mm512_add_epi16(a, r));
+    }
+}
+
+__attribute__((target("avx512f,avx512bw")))
+static void subtractRowAvx512(int16_t* accumulator, const int16_t* row) {
+    for (int i = 0; i < NETWORK_HIDDEN; i += 32) {
+        __m512i a = _mm512_loadu_si512(accumulator + i);
+        __m512i r = _mm512_loadu_si512(row + i);
+        _mm512_storeu_si512(accumulator + i, _mm512_sub_epi16(a, r));
+    }
+}
+
+__attribute__((target("avx2,avx512f,avx512bw,avx512vl,avx512vnni")))
+static void affineAvx512Vnni(const uint8_t* input, int inputSize,
+                             const int8_t* weights, const int32_t* biases,
+                             int32_t* output, int outputSize) {
+    for (int o = 0; o < outputSize; ++o) {
+        const int8_t* row = weights + o * inputSize;
+        __m512i sum = _mm512_setzero_si512();
+        int i = 0;
+        for (; i + 64 <= inputSize; i += 64) {
+            sum = _mm512_dpbusd_epi32(sum, _mm512_loadu_si512(input + i),
+                                      _mm512_loadu_si512(row + i));
+        }
+        int32_t total = horizontalSumAvx2(_mm256_add_epi32(
+                            _mm512_maskz_extracti64x4_epi64(0xFF, sum, 0),
+                            _mm512_maskz_extracti64x4_epi64(0xFF, sum, 1)));
+        if (i < inputSize) {
+            __m256i in = _mm256_loadu_si256(
+                             reinterpret_cast<const __m256i*>(input + i));
+            __m256i w = _mm256_loadu_si256(
+                            reinterpret_cast<const __m256i*>(row + i));
+            total += horizontalSumAvx2(
+                         _mm256_dpbusd_epi32(_mm256_setzero_si256(), in, w));
+        }
+        output[o] = biases[o] + total;
+    }
+}
+
+#endif
+
+// Kernel Selection
+// ================
+static SimdLevel simdLevel = ScalarSimd;
+static RowKernel addRow = addRowScalar;
+static RowKernel subtractRow = subtractRowScalar;
+static AffineKernel affine = affineScalar;
+
+// Function: isSupported
+// =====================
+// Returns true if the CPU running the program supports the given
+// instruction set.
+static bool isSupported(SimdLevel level) {
+#ifdef NETWORK_X86
+    __builtin_cpu_init();
+    switch (level) {
+        case Avx512VnniSimd:
+            return __builtin_cpu_supports("avx2") &&
+                   __builtin_cpu_supports("avx512f") &&
+                   __builtin_cpu_supports("avx512bw") &&
+                   __builtin_cpu_supports("avx512vl") &&
+                   __builtin_cpu_supports("avx512vnni");
+        case Avx2Simd:
+            return __builtin_cpu_supports("avx2");
+        case ScalarSimd:
+            return true;
+    }
+    return false;
+#else
+    return level == ScalarSimd;
+#endif
+}
+
+// Struct: KernelInitialiser
+// =========================
+// A single static instance of this struct picks the best
+// kernels supported by the CPU before main is entered.
+static struct KernelInitialiser {
+    KernelInitialiser() {
+        if (!Network::setSimdLevel(Avx512VnniSimd)) {
+            Network::setSimdLevel(Avx2Simd);
+        }
+    }
+} kernelInitialiser;
+
+// Function: alignedSize
+// =====================
+// Rounds a number of bytes up to a multiple of NETWORK_ALIGNMENT.
+static size_t alignedSize(size_t bytes) {
+    return (bytes + NETWORK_ALIGNMENT - 1) /
+           NETWORK_ALIGNMENT * NETWORK_ALIGNMENT;
+}
+
+// Function: clip
+// ==============
+// Clips a value to the range of the activations, [0, ACTIVATION_MAX].
+static uint8_t clip(int32_t value) {
+    return static_cast<uint8_t>(min(max(value, 0), ACTIVATION_MAX));
+}
+
+// Constructor: Default
+// ====================
+// Constructs a Network with no weights loaded.
+Network::Network() : mapping(nullptr), mappingSize(0) {
+    this->unload();
+}
+
+// Destructor:
+// ===========
+// Unmaps the file of the network, if any.
+Network::~Network() {
+    this->unload();
+}
+
+// Private Method: unload
+// ======================
+// Unmaps the file of the current network, if any.
+void Network::unload() {
+    if (this->mapping != nullptr) munmap(this->mapping, this->mappingSize);
+    this->mapping = nullptr;
+    this->mappingSize = 0;
+    this->featureBiases = nullptr;
+    this->featureWeights = nullptr;
+    this->l1Biases = nullptr;
+    this->l1Weights = nullptr;
+    this->l2Biases = nullptr;
+    this->l2Weights = nullptr;
+    this->outputBias = nullptr;
+    this->outputWeights = nullptr;
+}
+
+// Public Method: load
+// ===================
+// Takes the path of a network file and maps it into memory. Returns
+// false, leaving no network loaded, if the file cannot be opened or
+// does not match the format described in Network.hpp.
+bool Network::load(const string& path) {
+    this->unload();
+
+    // The offset of each array in the file.
+    size_t offsets[9];
+    const size_t sizes[8] = {
+        NETWORK_HIDDEN * sizeof(int16_t),
+        static_cast<size_t>(NETWORK_INPUTS) * NETWORK_HIDDEN * sizeof(int16_t),
+        NETWORK_L2 * sizeof(int32_t),
+        NETWORK_L2 * NETWORK_L1 * sizeof(int8_t),
+        NETWORK_L3 * sizeof(int32_t),
+        NETWORK_L3 * NETWORK_L2 * sizeof(int8_t),
+        sizeof(int32_t),
+        NETWORK_L3 * sizeof(int8_t)
+    };
+    offsets[0] = NETWORK_ALIGNMENT;
+    for (int i = 0; i < 8; ++i) {
+        offsets[i + 1] = offsets[i] + alignedSize(sizes[i]);
+    }
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat status;
+    if (fstat(fd, &status) != 0 ||
+        static_cast<size_t>(status.st_size) != offsets[8]) {
+        close(fd);
+        return false;
+    }
+    void* mapping = mmap(nullptr, offsets[8], PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) return false;
+
+    // Check the header before trusting the rest of the file.
+    const char* bytes = static_cast<const char*>(mapping);
+    int32_t dimensions[4];
+    memcpy(dimensions, bytes + sizeof(NETWORK_MAGIC), sizeof(dimensions));
+    if (memcmp(bytes, NETWORK_MAGIC, sizeof(NETWORK_MAGIC)) != 0 ||
+        dimensions[0] != NETWORK_INPUTS || dimensions[1] != NETWORK_HIDDEN ||
+        dimensions[2] != NETWORK_L2 || dimensions[3] != NETWORK_L3) {
+        munmap(mapping, offsets[8]);
+        return false;
+    }
+
+    this->mapping = mapping;
+    this->mappingSize = offsets[8];
+    this->featureBiases =
+        reinterpret_cast<const int16_t*>(bytes + offsets[0]);
+    this->featureWeights =
+        reinterpret_cast<const int16_t*>(bytes + offsets[1]);
+    this->l1Biases = reinterpret_cast<const int32_t*>(bytes + offsets[2]);
+    this->l1Weights = reinterpret_cast<const int8_t*>(bytes + offsets[3]);
+    this->l2Biases = reinterpret_cast<const int32_t*>(bytes + offsets[4]);
+    this->l2Weights = reinterpret_cast<const int8_t*>(bytes + offsets[5]);
+    this->outputBias = reinterpret_cast<const int32_t*>(bytes + offsets[6]);
+    this->outputWeights =
+        reinterpret_cast<const int8_t*>(bytes + offsets[7]);
+    return true;
+}
+
+// Public Method: isLoaded
+// =======================
+// Returns true if a network has been loaded.
+bool Network::isLoaded() const {
+    return this->mapping != nullptr;
+}
+
+// Public Method: getFeatureBiases
+// ===============================
+// Returns the biases of the feature transformer.
+const int16_t* Network::getFeatureBiases() const {
+    return this->featureBiases;
+}
+
+// Public Method: getFeatureWeights
+// ================================
+// Takes the index of a feature and returns its row of
+// NETWORK_HIDDEN weights in the feature transformer.
+const int16_t* Network::getFeatureWeights(int feature) const {
+    return this->featureWeights +
+           static_cast<size_t>(feature) * NETWORK_HIDDEN;
+}
+
+// Public Method: propagate
+// ========================
+// Takes the accumulators of the side to move and of its opponent and
+// runs them through the dense layers, returning the score of the
+// Position in centipawns from the side to move's point of view.
+int Network::propagate(const int16_t* us, const int16_t* them) const {
+    alignas(NETWORK_ALIGNMENT) uint8_t input[NETWORK_L1];
+    alignas(NETWORK_ALIGNMENT) int32_t l1Output[NETWORK_L2];
+    alignas(NETWORK_ALIGNMENT) uint8_t l2Input[NETWORK_L2];
+    alignas(NETWORK_ALIGNMENT) int32_t l2Output[NETWORK_L3];
+    alignas(NETWORK_ALIGNMENT) uint8_t outputInput[NETWORK_L3];
+    int32_t output;
+
+    for (int i = 0; i < NETWORK_HIDDEN; ++i) {
+        input[i] = clip(us[i]);
+        input[NETWORK_HIDDEN + i] = clip(them[i]);
+    }
+
+    affine(input, NETWORK_L1, this->l1Weights, this->l1Biases,
+           l1Output, NETWORK_L2);
+    for (int i = 0; i < NETWORK_L2; ++i) {
+        l2Input[i] = clip(l1Output[i] >> WEIGHT_SHIFT);
+    }
+
+    affine(l2Input, NETWORK_L2, this->l2Weights, this->l2Biases,
+           l2Output, NETWORK_L3);
+    for (int i = 0; i < NETWORK_L3; ++i) {
+        outputInput[i] = clip(l2Output[i] >> WEIGHT_SHIFT);
+    }
+
+    affine(outputInput, NETWORK_L3, this->outputWeights, this->outputBias,
+           &output, 1);
+    return output / OUTPUT_SCALE;
+}
+
+// Public Method: addWeights
+// =========================
+// Adds the row of weights of a feature to an accumulator.
+void Network::addWeights(int16_t* accumulator, const int16_t* row) {
+    addRow(accumulator, row);
+}
+
+// Public Method: subtractWeights
+// ==============================
+// Subtracts the row of weights of a feature from an accumulator.
+void Network::subtractWeights(int16_t* accumulator, const int16_t* row) {
+    subtractRow(accumulator, row);
+}
+
+// Public Method: getSimdLevel
+// ===========================
+// Returns the instruction set the kernels currently run with.
+SimdLevel Network::getSimdLevel() {
+    return simdLevel;
+}
+
+// Public Method: setSimdLevel
+// ===========================
+// Selects the instruction set to run the kernels with. Returns
+// false, changing nothing, if the CPU does not support it.
+bool Network::setSimdLevel(SimdLevel level) {
+    if (!isSupported(level)) return false;
+    simdLevel = level;
+    switch (level) {
+#ifdef NETWORK_X86
+        case Avx512VnniSimd:
+            addRow = addRowAvx512;
+            subtractRow = subtractRowAvx512;
+            affine = affineAvx512Vnni;
+            break;
+        case Avx2Simd:
+            addRow = addRowAvx2;
+            subtractRow = subtractRowAvx2;
+            affine = affineAvx2;
+            break;
+#endif
+        default:
+            addRow = addRowScalar;
+            subtractRow = subtractRowScalar;
+            affine = affineScalar;
+    }
+    return true;
+}
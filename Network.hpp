@@ -0,0 +1,165 @@
+// ==========================================
+// File:    Network.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef NETWORK_HPP
+#define NETWORK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+using namespace std;
+
+#include "Position.hpp"
+
+// Constants: Network
+// ==================
+// The dimensions of the neural network used by the Evaluation. Its
+// input is a HalfKP feature set: for each side, one feature for every
+// combination of the square of that side's King and a non-King Piece
+// on a square, seen from that side's point of view. Both sides feed a
+// hidden layer of NETWORK_HIDDEN neurons, and their outputs are then
+// concatenated and passed through two small dense layers.
+const int NETWORK_KING_SQUARES = NUM_SQUARES;
+const int NETWORK_PIECE_SQUARES = 10 * NUM_SQUARES;
+const int NETWORK_INPUTS = NETWORK_KING_SQUARES * NETWORK_PIECE_SQUARES;
+const int NETWORK_HIDDEN = 256;
+const int NETWORK_L1 = 2 * NETWORK_HIDDEN;
+const int NETWORK_L2 = 32;
+const int NETWORK_L3 = 32;
+const int NETWORK_ALIGNMENT = 64;
+
+// Enum: SimdLevel
+// ===============
+// The instruction sets the Network can run its kernels with. The
+// best one supported by the CPU is picked when the program starts.
+enum SimdLevel {ScalarSimd, Avx2Simd, Avx512VnniSimd};
+
+// Class: Network
+// ==============
+// This class holds the weights of the neural network used by the
+// Evaluation and runs it. The weights are quantised, with 16-bit
+// weights for the feature transformer and 8-bit weights for the dense
+// layers, and are mapped straight from a file into memory, so loading
+// a network is cheap and several searches can share the same one.
+//
+// A network file starts with a header of NETWORK_ALIGNMENT bytes: the
+// eight bytes "CHESSNN1", followed by the 32-bit little-endian values
+// NETWORK_INPUTS, NETWORK_HIDDEN, NETWORK_L2 and NETWORK_L3, with the
+// rest of the header set to zero. It is followed by these arrays, each
+// padded with zeros to a multiple of NETWORK_ALIGNMENT bytes:
+//
+//     int16 featureBiases[NETWORK_HIDDEN]
+//     int16 featureWeights[NETWORK_INPUTS][NETWORK_HIDDEN]
+//     int32 l1Biases[NETWORK_L2]
+//     int8  l1Weights[NETWORK_L2][NETWORK_L1]
+//     int32 l2Biases[NETWORK_L3]
+//     int8  l2Weights[NETWORK_L3][NETWORK_L2]
+//     int32 outputBias
+//     int8  outputWeights[NETWORK_L3]
+class Network {
+
+    private:
+
+        void* mapping;          // Start of the mapped file.
+        size_t mappingSize;     // Size of the mapped file.
+
+        // Pointers into the mapped file.
+        const int16_t* featureBiases;
+        const int16_t* featureWeights;
+        const int32_t* l1Biases;
+        const int8_t* l1Weights;
+        const int32_t* l2Biases;
+        const int8_t* l2Weights;
+        const int32_t* outputBias;
+        const int8_t* outputWeights;
+
+        // Method: unload
+        // ==============
+        // Unmaps the file of the current network, if any.
+        void unload();
+
+        // Copying would unmap the file twice.
+        Network(const Network& other);
+        Network& operator=(const Network& other);
+
+    public:
+
+        // Constructor: Default
+        // ====================
+        // Constructs a Network with no weights loaded.
+        Network();
+
+        // Destructor:
+        // ===========
+        virtual ~Network();
+
+        // Method: load
+        // ============
+        // Takes the path of a network file and maps it into memory.
+        // Returns false, leaving no network loaded, if the file cannot
+        // be opened or does not match the format described above.
+        bool load(const string& path);
+
+        // Method: isLoaded
+        // ================
+        // Returns true if a network has been loaded.
+        bool isLoaded() const;
+
+        // Method: getFeatureBiases
+        // ========================
+        // Returns the biases of the feature transformer.
+        const int16_t* getFeatureBiases() const;
+
+        // Method: getFeatureWeights
+        // =========================
+        // Takes the index of a feature and returns its row of
+        // NETWORK_HIDDEN weights in the feature transformer.
+        const int16_t* getFeatureWeights(int feature) const;
+
+        // Method: propagate
+        // =================
+        // Takes the accumulators of the side to move and of its opponent
+        // and runs them through the dense layers, returning the score of
+        // the Position in centipawns from the side to move's view.
+        int propagate(const int16_t* us, const int16_t* them) const;
+
+        // Method: featureIndex
+        // ====================
+        // Takes a perspective, the square of that side's King and a
+        // non-King Piece on a square, and returns the index of the
+        // matching input feature. Squares are flipped vertically for
+        // Black, so that both sides see the board from their own side.
+        static int featureIndex(Color perspective, int kingSquare,
+                                Piece piece, int square) {
+            int flipSquares = (perspective == White) ? 0 : 56;
+            int pieceIndex = 2 * typeOf(piece) +
+                             (colorOf(piece) != perspective);
+            return (kingSquare ^ flipSquares) * NETWORK_PIECE_SQUARES +
+                   pieceIndex * NUM_SQUARES + (square ^ flipSquares);
+        }
+
+        // Method: addWeights
+        // ==================
+        // Adds (or subtracts) the row of weights of a feature to
+        // an accumulator of NETWORK_HIDDEN values.
+        static void addWeights(int16_t* accumulator, const int16_t* row);
+        static void subtractWeights(int16_t* accumulator,
+                                    const int16_t* row);
+
+        // Method: getSimdLevel
+        // ====================
+        // Returns the instruction set the kernels currently run with.
+        static SimdLevel getSimdLevel();
+
+        // Method: setSimdLevel
+        // ====================
+        // Selects the instruction set to run the kernels with, e.g. to
+        // compare them in a benchmark. Returns false, changing nothing,
+        // if the CPU does not support it.
+        static bool setSimdLevel(SimdLevel level);
+};
+
+#endif
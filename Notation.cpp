@@ -0,0 +1,229 @@
+// ==========================================
+// File:    Notation.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <cstring>
+using namespace std;
+
+#include "Notation.hpp"
+#include "MoveGenerator.hpp"
+#include "Settings.hpp"
+
+// Lookup Table: PIECE_LETTERS
+// ===========================
+// The letter standing for each PieceType in algebraic notation.
+// Pawns have none, so theirs is never written.
+static const char PIECE_LETTERS[] = "PNBRQK";
+
+// Function: isOneOf
+// ==================
+// Returns true if the character is one of the given characters.
+static bool isOneOf(char c, const char* characters) {
+    return c != '\0' && strchr(characters, c) != nullptr;
+}
+
+// Function: parsePieceLetter
+// ==========================
+// Takes a character and returns the PieceType of the piece it stands
+// for, or NoPieceType if it is not the letter of a piece.
+static PieceType parsePieceLetter(char c) {
+    if (!isOneOf(c, PIECE_LETTERS + KnightType)) return NoPieceType;
+    return static_cast<PieceType>(strchr(PIECE_LETTERS, c) - PIECE_LETTERS);
+}
+
+// Function: isFile
+// ================
+// Returns true if the character is a file in algebraic notation.
+static bool isFile(char c) {
+    return c >= 'a' && c < 'a' + SIDE_LEN;
+}
+
+// Function: isRank
+// ================
+// Returns true if the character is a rank in algebraic notation.
+static bool isRank(char c) {
+    return c >= '0' + BOTTOM_RANK && c <= '0' + TOP_RANK;
+}
+
+// Function: writeSquare
+// =====================
+// Writes the square with the given index, e.g. "e4", into the buffer
+// and returns the number of characters written.
+static int writeSquare(int square, char* buffer) {
+    buffer[0] = static_cast<char>(squareFile(square) - LEFTMOST_FILE + 'a');
+    buffer[1] = static_cast<char>('0' + squareRank(square));
+    return 2;
+}
+
+// Function: writeSuffix
+// =====================
+// Plays the Move on a copy of the Position and, if it gives check,
+// writes "+", or "#" if it is mate, into the buffer. Then ends the
+// buffer with a null character and returns the number of characters
+// written, not counting it.
+static int writeSuffix(const Position& position, Move move, char* buffer) {
+    Position next = position;
+    UndoInfo undo;
+    next.makeMove(move, undo);
+
+    int length = 0;
+    if (next.isInCheck(next.getSideToMove())) {
+        MoveList moves;
+        MoveGenerator(next).generateLegal(moves);
+        buffer[length++] = moves.isEmpty() ? '#' : '+';
+    }
+    buffer[length] = '\0';
+    return length;
+}
+
+// Function: parseSan
+// ==================
+// Takes a Position and a move in SAN or LAN and returns the legal Move
+// it stands for, or the null Move if there is not exactly one. The text
+// is read as an optional piece letter, an optional source file and/or
+// rank, an optional capture or move sign and the destination square.
+// Every piece of the side to move that fits that description is tried.
+Move parseSan(const Position& position, string_view san) {
+
+    // Drop any check, mate and annotation suffixes.
+    while (!san.empty() && isOneOf(san.back(), "+#!?")) {
+        san.remove_suffix(1);
+    }
+
+    // Castling and promotion, the only moves whose notation does not
+    // end with the destination square, do not exist in this program.
+    if (san.size() < 2 || !isFile(san[san.size() - 2]) ||
+        !isRank(san.back())) {
+        return Move();
+    }
+    int to = squareIndex(static_cast<char>(san[san.size() - 2] - 'a' +
+                                           LEFTMOST_FILE),
+                         san.back() - '0');
+    san.remove_suffix(2);
+
+    // A piece letter is only left out for pawns.
+    PieceType type = PawnType;
+    bool hasPieceLetter = false;
+    if (!san.empty()) {
+        type = parsePieceLetter(san.front());
+        hasPieceLetter = (type != NoPieceType);
+        if (hasPieceLetter) {
+            san.remove_prefix(1);
+        } else {
+            type = PawnType;
+        }
+    }
+
+    // Then come the source file and rank, if given, and the sign.
+    if (!san.empty() && isOneOf(san.back(), "x:-")) {
+        san.remove_suffix(1);
+    }
+    int fromFile = -1;
+    int fromRank = -1;
+    if (!san.empty() && isFile(san.front())) {
+        fromFile = san.front() - 'a';
+        san.remove_prefix(1);
+    }
+    if (!san.empty() && isRank(san.front())) {
+        fromRank = san.front() - '0';
+        san.remove_prefix(1);
+    }
+    if (!san.empty()) return Move();
+
+    // A bare pair of squares may be a move of any piece.
+    Color us = position.getSideToMove();
+    Bitboard candidates = position.getPieces(us, type);
+    if (!hasPieceLetter && fromFile >= 0 && fromRank >= 0) {
+        candidates = position.getPieces(us);
+    }
+
+    Move found;
+    while (candidates) {
+        int from = popLsb(candidates);
+        if ((fromFile >= 0 && squareFile(from) - LEFTMOST_FILE != fromFile) ||
+            (fromRank >= 0 && squareRank(from) != fromRank)) {
+            continue;
+        }
+        Move move(from, to);
+        if (position.isPseudoLegal(move) && position.isLegal(move)) {
+            if (!found.isNull()) return Move();
+            found = move;
+        }
+    }
+    return found;
+}
+
+// Function: writeSan
+// ==================
+// Takes a Position and one of its legal Moves and writes the Move in
+// SAN. A piece move names the file of its source square if another
+// piece of the same type could make it too, else its rank if they
+// share the file, else both. A pawn capture names the source file.
+int writeSan(const Position& position, Move move, char* buffer) {
+    int from = move.getFrom();
+    int to = move.getTo();
+    PieceType type = typeOf(position.pieceOn(from));
+    bool isCapture = position.pieceOn(to) != NO_PIECE;
+
+    int length = 0;
+    if (type == PawnType) {
+        if (isCapture) {
+            buffer[length++] = static_cast<char>(squareFile(from) -
+                                                 LEFTMOST_FILE + 'a');
+        }
+    } else {
+        buffer[length++] = PIECE_LETTERS[type];
+
+        // Look for the other pieces of this type that can move there.
+        bool isAmbiguous = false;
+        bool isFileShared = false;
+        bool isRankShared = false;
+        Bitboard others = position.getPieces(position.getSideToMove(), type)
+                          & ~squareBit(from);
+        while (others) {
+            int other = popLsb(others);
+            Move alternative(other, to);
+            if (position.isPseudoLegal(alternative) &&
+                position.isLegal(alternative)) {
+                isAmbiguous = true;
+                isFileShared |= squareFile(other) == squareFile(from);
+                isRankShared |= squareRank(other) == squareRank(from);
+            }
+        }
+        if (isAmbiguous) {
+            char square[2];
+            writeSquare(from, square);
+            if (!isFileShared) {
+                buffer[length++] = square[0];
+            } else if (!isRankShared) {
+                buffer[length++] = square[1];
+            } else {
+                buffer[length++] = square[0];
+                buffer[length++] = square[1];
+            }
+        }
+    }
+
+    if (isCapture) buffer[length++] = 'x';
+    length += writeSquare(to, buffer + length);
+    return length + writeSuffix(position, move, buffer + length);
+}
+
+// Function: writeLan
+// ==================
+// Takes a Position and one of its legal Moves and writes the Move in
+// LAN, which always names both squares, e.g. "Ng1-f3" or "e4xd5".
+int writeLan(const Position& position, Move move, char* buffer) {
+    int from = move.getFrom();
+    int to = move.getTo();
+    PieceType type = typeOf(position.pieceOn(from));
+
+    int length = 0;
+    if (type != PawnType) buffer[length++] = PIECE_LETTERS[type];
+    length += writeSquare(from, buffer + length);
+    buffer[length++] = (position.pieceOn(to) != NO_PIECE) ? 'x' : '-';
+    length += writeSquare(to, buffer + length);
+    return length + writeSuffix(position, move, buffer + length);
+}
@@ -0,0 +1,55 @@
+// ==========================================
+// File:    Notation.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef NOTATION_HPP
+#define NOTATION_HPP
+
+#include <string_view>
+using namespace std;
+
+#include "Position.hpp"
+#include "Move.hpp"
+
+// Constants: Notation
+// ===================
+// The longest move written by writeSan or writeLan, e.g. "Qa1xb2#",
+// including the null character that ends it. Buffers passed to them
+// must have room for this many characters.
+const int MAX_NOTATION_LENGTH = 8;
+
+// Functions: Algebraic Notation
+// =============================
+// These functions read and write moves in Standard Algebraic Notation
+// (SAN), e.g. "Nbd7" or "exd5+", and in Long Algebraic Notation (LAN),
+// e.g. "Nb8-d7" or "e4xd5+", for the side to move in a Position. They
+// work on the text in place and look only at the few pieces that could
+// make a move, so they never allocate. There is no castling or
+// promotion in this program, so "O-O" or "e8=Q" never match a move.
+
+// Function: parseSan
+// ==================
+// Takes a Position and a move in SAN or LAN and returns the legal Move
+// it stands for. Check, mate and annotation suffixes are ignored and a
+// bare pair of squares, e.g. "g1f3", is read as LAN. Returns the null
+// Move if the text is not a move, or if no legal Move or more than one
+// matches it, e.g. "Nd7" when both Knights can go there.
+Move parseSan(const Position& position, string_view san);
+
+// Function: writeSan
+// ==================
+// Takes a Position and one of its legal Moves and writes the Move in
+// SAN into the given buffer, followed by a null character. Returns the
+// number of characters written, not counting the null character.
+int writeSan(const Position& position, Move move, char* buffer);
+
+// Function: writeLan
+// ==================
+// Takes a Position and one of its legal Moves and writes the Move in
+// LAN into the given buffer, followed by a null character. Returns the
+// number of characters written, not counting the null character.
+int writeLan(const Position& position, Move move, char* buffer);
+
+#endif
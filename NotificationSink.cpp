@@ -0,0 +1,191 @@
+// ==========================================
+// File:    NotificationSink.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <iostream>
+#include <sstream>
+using namespace std;
+
+#include "NotificationSink.hpp"
+
+// Constants: Messages
+// ===================
+// The text of the notifications that are the same every time.
+static const char GAME_STARTED_MESSAGE[] = "A new chess game is started!";
+
+// Function: writeSquareRejected
+// =============================
+// Takes a stream, the text of a square that could not be read and
+// whether it was the source square, and writes the message about it.
+static void writeSquareRejected(ostream& os, const string& input,
+                                bool isSource) {
+    os << "ERROR! Caught InvalidCoordinatesException when calling "
+       << "ChessSquare constructor for "
+       << (isSource ? "source" : "destination") << " ChessSquare with "
+       << "input=" << input << " in ChessBoard::submitMove.";
+}
+
+// Public Method: getInstance
+// ==========================
+// Returns a NullSink that may be shared by any ChessBoard.
+NullSink& NullSink::getInstance() {
+    static NullSink instance;
+    return instance;
+}
+
+// Public Method: getInstance
+// ==========================
+// Returns a ConsoleSink that may be shared by any ChessBoard.
+ConsoleSink& ConsoleSink::getInstance() {
+    static ConsoleSink instance;
+    return instance;
+}
+
+// Public Method: gameStarted
+// ==========================
+// Tells the client on the console that a new game has started.
+void ConsoleSink::gameStarted() {
+    cout << GAME_STARTED_MESSAGE << endl;
+}
+
+// Public Method: moveSubmitted
+// ============================
+// Prints the message describing the MoveResult.
+void ConsoleSink::moveSubmitted(const MoveResult& result) {
+    cout << result << endl;
+}
+
+// Public Method: squareRejected
+// =============================
+// Prints the message about a square that could not be read.
+void ConsoleSink::squareRejected(const string& input, bool isSource) {
+    writeSquareRejected(cout, input, isSource);
+    cout << endl;
+}
+
+// Public Method: errorRaised
+// ==========================
+// Prints the error message to cerr.
+void ConsoleSink::errorRaised(const string& message) {
+    cerr << message << endl;
+}
+
+// Public Method: gameStarted
+// ==========================
+// Appends the line telling that a new game has started.
+void TextSink::gameStarted() {
+    this->text += GAME_STARTED_MESSAGE;
+    this->text += '\n';
+}
+
+// Public Method: moveSubmitted
+// ============================
+// Appends the message describing the MoveResult.
+void TextSink::moveSubmitted(const MoveResult& result) {
+    ostringstream ss;
+    ss << result << '\n';
+    this->text += ss.str();
+}
+
+// Public Method: squareRejected
+// =============================
+// Appends the message about a square that could not be read.
+void TextSink::squareRejected(const string& input, bool isSource) {
+    ostringstream ss;
+    writeSquareRejected(ss, input, isSource);
+    ss << '\n';
+    this->text += ss.str();
+}
+
+// Public Method: errorRaised
+// ==========================
+// Appends the error message.
+void TextSink::errorRaised(const string& message) {
+    this->text += message;
+    this->text += '\n';
+}
+
+// Public Method: getText
+// ======================
+// Returns the text rendered since the last call to clear.
+const string& TextSink::getText() const {
+    return this->text;
+}
+
+// Public Method: clear
+// ====================
+// Empties the buffer, keeping the memory it has taken.
+void TextSink::clear() {
+    this->text.clear();
+}
+
+// Private Method: appendText
+// ==========================
+// Takes a record kind and a text and appends the record, cutting
+// the text short if it is longer than a byte can tell.
+void BinarySink::appendText(uint8_t kind, const string& text) {
+    size_t length = (text.size() < 0xFF) ? text.size() : 0xFF;
+    this->data.push_back(kind);
+    this->data.push_back(static_cast<uint8_t>(length));
+    this->data.insert(this->data.end(), text.begin(), text.begin() + length);
+}
+
+// Public Method: gameStarted
+// ==========================
+// Appends a record telling that a new game has started.
+void BinarySink::gameStarted() {
+    this->data.push_back(GameStartedRecord);
+}
+
+// Public Method: moveSubmitted
+// ============================
+// Appends a record holding the MoveResult: its status, the Color, the
+// types of the pieces moved and captured, the source and destination
+// squares, and a byte with bits for check, checkmate and stalemate
+// followed by the Termination of the game, if the move ended it.
+void BinarySink::moveSubmitted(const MoveResult& result) {
+    uint8_t record[] = {
+        MoveSubmittedRecord,
+        static_cast<uint8_t>(result.status),
+        static_cast<uint8_t>(result.color),
+        static_cast<uint8_t>(result.moved),
+        static_cast<uint8_t>(result.captured),
+        result.from,
+        result.to,
+        static_cast<uint8_t>(result.isCheck | (result.isCheckmate << 1) |
+                             (result.isStalemate << 2) |
+                             (result.termination << 3))
+    };
+    this->data.insert(this->data.end(), record, record + sizeof(record));
+}
+
+// Public Method: squareRejected
+// =============================
+// Appends a record holding the text of a square that could not be read.
+void BinarySink::squareRejected(const string& input, bool isSource) {
+    this->appendText(isSource ? SourceRejectedRecord
+                              : DestinationRejectedRecord, input);
+}
+
+// Public Method: errorRaised
+// ==========================
+// Appends a record holding the error message.
+void BinarySink::errorRaised(const string& message) {
+    this->appendText(ErrorRaisedRecord, message);
+}
+
+// Public Method: getData
+// ======================
+// Returns the records appended since the last call to clear.
+const vector<uint8_t>& BinarySink::getData() const {
+    return this->data;
+}
+
+// Public Method: clear
+// ====================
+// Empties the buffer, keeping the memory it has taken.
+void BinarySink::clear() {
+    this->data.clear();
+}
@@ -0,0 +1,169 @@
+// ==========================================
+// File:    NotificationSink.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef NOTIFICATION_SINK_HPP
+#define NOTIFICATION_SINK_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+using namespace std;
+
+#include "MoveResult.hpp"
+
+// Class: NotificationSink
+// =======================
+// This class is the interface through which a ChessBoard notifies its
+// client about the game: when a game starts, the outcome of every move
+// submitted, squares it could not read and errors. Each notification
+// carries the raw facts, e.g. a MoveResult, and it is up to the sink
+// whether and how to render them, so that a ChessBoard never formats
+// or writes anything itself. The sinks below are final, so calls made
+// through one of them directly are resolved at compile time.
+class NotificationSink {
+
+    public:
+
+        // Destructor:
+        // ===========
+        virtual ~NotificationSink() {}
+
+        // Method: gameStarted
+        // ===================
+        // Called when a new game is started or set up.
+        virtual void gameStarted() = 0;
+
+        // Method: moveSubmitted
+        // =====================
+        // Takes the MoveResult of a move that has just been submitted,
+        // whether it was played or not.
+        virtual void moveSubmitted(const MoveResult& result) = 0;
+
+        // Method: squareRejected
+        // ======================
+        // Takes the text of a source or destination square submitted
+        // with a move that does not name a square on the board.
+        virtual void squareRejected(const string& input, bool isSource) = 0;
+
+        // Method: errorRaised
+        // ===================
+        // Takes the message of an error that should never happen,
+        // e.g. one caused by a corrupted ChessBoard.
+        virtual void errorRaised(const string& message) = 0;
+};
+
+// Class: NullSink
+// ===============
+// A NotificationSink that ignores every notification, for a ChessBoard
+// driven by a program, e.g. in batch jobs or on a server.
+class NullSink final : public NotificationSink {
+
+    public:
+
+        void gameStarted() override {}
+        void moveSubmitted(const MoveResult&) override {}
+        void squareRejected(const string&, bool) override {}
+        void errorRaised(const string&) override {}
+
+        // Method: getInstance
+        // ===================
+        // Returns a NullSink that may be shared by any ChessBoard.
+        static NullSink& getInstance();
+};
+
+// Class: ConsoleSink
+// ==================
+// A NotificationSink that prints every notification to the console as
+// it comes, errors to cerr and the rest to cout. It is the sink used by
+// default, so that a game can be played on the console.
+class ConsoleSink final : public NotificationSink {
+
+    public:
+
+        void gameStarted() override;
+        void moveSubmitted(const MoveResult& result) override;
+        void squareRejected(const string& input, bool isSource) override;
+        void errorRaised(const string& message) override;
+
+        // Method: getInstance
+        // ===================
+        // Returns a ConsoleSink that may be shared by any ChessBoard.
+        static ConsoleSink& getInstance();
+};
+
+// Class: TextSink
+// ===============
+// A NotificationSink that renders every notification as the same text
+// a ConsoleSink prints, but appends it to a buffer in memory instead,
+// to be read or written out in one go whenever the client chooses.
+class TextSink final : public NotificationSink {
+
+    private:
+
+        string text;    // Text rendered since the last clear.
+
+    public:
+
+        void gameStarted() override;
+        void moveSubmitted(const MoveResult& result) override;
+        void squareRejected(const string& input, bool isSource) override;
+        void errorRaised(const string& message) override;
+
+        // Method: getText
+        // ===============
+        // Returns the text rendered since the last call to clear.
+        const string& getText() const;
+
+        // Method: clear
+        // =============
+        // Empties the buffer, keeping the memory it has taken.
+        void clear();
+};
+
+// Class: BinarySink
+// =================
+// A NotificationSink that appends every notification to a buffer as a
+// compact record, to be shipped to another program as is. A record is
+// one byte giving its kind, followed for a move by the fields of its
+// MoveResult, one byte each, and for a square or error by the length
+// of its text, in one byte, and the text itself.
+class BinarySink final : public NotificationSink {
+
+    private:
+
+        vector<uint8_t> data;   // Records appended since the last clear.
+
+        // Method: appendText
+        // ==================
+        // Takes a record kind and a text and appends the record.
+        void appendText(uint8_t kind, const string& text);
+
+    public:
+
+        // Enum: RecordKind
+        // ================
+        // The kind of each record, i.e. the notification it holds.
+        enum RecordKind {GameStartedRecord, MoveSubmittedRecord,
+                         SourceRejectedRecord, DestinationRejectedRecord,
+                         ErrorRaisedRecord};
+
+        void gameStarted() override;
+        void moveSubmitted(const MoveResult& result) override;
+        void squareRejected(const string& input, bool isSource) override;
+        void errorRaised(const string& message) override;
+
+        // Method: getData
+        // ===============
+        // Returns the records appended since the last call to clear.
+        const vector<uint8_t>& getData() const;
+
+        // Method: clear
+        // =============
+        // Empties the buffer, keeping the memory it has taken.
+        void clear();
+};
+
+#endif
@@ -0,0 +1,44 @@
+// ==========================================
+// File:    OutputWriter.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include "OutputWriter.hpp"
+
+// Constructor:
+// ============
+// Takes the stream to write the output to.
+OutputWriter::OutputWriter(ostream& out) : out(out) {}
+
+// Public Method: writeLine
+// ========================
+// Takes a line, without its line break, and adds it to the buffer.
+void OutputWriter::writeLine(const string& line) {
+    lock_guard<mutex> guard(this->lock);
+    this->buffer += line;
+    this->buffer += '\n';
+}
+
+// Public Method: flush
+// ====================
+// Writes out all of the buffered lines at once and flushes.
+void OutputWriter::flush() {
+    lock_guard<mutex> guard(this->lock);
+    this->out.write(this->buffer.data(), this->buffer.size());
+    this->out.flush();
+    this->buffer.clear();
+}
+
+// Public Method: send
+// ===================
+// Takes a line and writes it out right away, together with any line
+// still in the buffer, with a single write and a single flush.
+void OutputWriter::send(const string& line) {
+    lock_guard<mutex> guard(this->lock);
+    this->buffer += line;
+    this->buffer += '\n';
+    this->out.write(this->buffer.data(), this->buffer.size());
+    this->out.flush();
+    this->buffer.clear();
+}
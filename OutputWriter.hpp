@@ -0,0 +1,59 @@
+// ==========================================
+// File:    OutputWriter.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef OUTPUT_WRITER_HPP
+#define OUTPUT_WRITER_HPP
+
+#include <mutex>
+#include <ostream>
+#include <string>
+using namespace std;
+
+// Class: OutputWriter
+// ===================
+// This class is the single point through which a program that talks to
+// another program writes its output. Lines are gathered in a buffer and
+// written out and flushed together when flush is called, rather than
+// flushing the stream after every line as endl does. Several threads
+// may write through the same OutputWriter, as every call is serialised.
+class OutputWriter {
+
+    private:
+
+        ostream& out;       // Stream the output goes to.
+        string buffer;      // Lines written since the last flush.
+        mutex lock;         // Serialises writes and flushes.
+
+        // Copying would share the stream without sharing the lock.
+        OutputWriter(const OutputWriter& other);
+        OutputWriter& operator=(const OutputWriter& other);
+
+    public:
+
+        // Constructor:
+        // ============
+        // Takes the stream to write the output to.
+        OutputWriter(ostream& out);
+
+        // Method: writeLine
+        // =================
+        // Takes a line, without its line break, and adds it to the
+        // buffer. Nothing is written out until flush is called.
+        void writeLine(const string& line);
+
+        // Method: flush
+        // =============
+        // Writes out all of the buffered lines at once and flushes.
+        void flush();
+
+        // Method: send
+        // ============
+        // Takes a line and writes it out right away, together with
+        // any line still in the buffer.
+        void send(const string& line);
+};
+
+#endif
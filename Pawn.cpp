@@ -12,14 +12,15 @@ using namespace std;
 
 // Constructor: Default
 // ====================
-Pawn::Pawn() : ChessPiece() {}
+Pawn::Pawn() : ChessPiece() {
+    this->type = PawnType;
+}
 
 // Constructor:
 // ============
 // This constructor takes a Color and creates a Pawn of that Color.
 Pawn::Pawn(Color color) : ChessPiece(color) {
-    this->name = PAWN_NAME;
-    this->initSymbol(color);
+    this->type = PawnType;
 }
 
 // Constructor:
@@ -28,8 +29,7 @@ Pawn::Pawn(Color color) : ChessPiece(color) {
 // constructs a Pawn of that Color, setting its square
 // property to point to the given ChessSquare.
 Pawn::Pawn(Color c, const ChessSquare& cs) : ChessPiece(c, cs) {
-    this->name = PAWN_NAME;
-    this->initSymbol(c);
+    this->type = PawnType;
 }
 
 // Destructor:
@@ -133,14 +133,6 @@ pair<bool, bool> Pawn::isPossibleMove(ChessSquare& square,
     return rvalue;
 }
 
-// Private Method: initSymbol
-// ==========================
-// This method initialises the symbol
-// property of the Pawn given its Color.
-void Pawn::initSymbol(Color color) {
-    this->symbol = (color == White) ? WHITE_PAWN : BLACK_PAWN;
-}
-
 // Friend Operator: <<
 // ===================
 // Outputs the symbol property of the Pawn operand.
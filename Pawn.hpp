@@ -18,14 +18,6 @@ using namespace std;
 // is a subclass of ChessPiece. This class defines how a Pawn can move,
 // its name and the symbol it is given according to its Color.
 class Pawn : public ChessPiece {
-    
-    private:
-
-        // Method: initSymbol
-        // ==================
-        // This method initialises the symbol
-        // property of the Pawn given its Color.
-        void initSymbol(Color color);
 
     public:
 
@@ -0,0 +1,149 @@
+// ==========================================
+// File:    PawnTable.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <algorithm>
+using namespace std;
+
+#include "PawnTable.hpp"
+#include "Settings.hpp"
+
+// Constructor: Default
+// ====================
+// Constructs an empty PawnTable.
+PawnTable::PawnTable() : entries(PAWN_TABLE_SIZE) {
+    this->clear();
+}
+
+// Public Method: clear
+// ====================
+// Empties the table and resets its statistics. An empty entry has the
+// key of a Position without Pawns and scores it correctly, at zero, so
+// it needs no separate flag; only its shields are marked as unknown.
+void PawnTable::clear() {
+    PawnEntry empty = PawnEntry();
+    empty.kingSquares[White] = NO_SQUARE;
+    empty.kingSquares[Black] = NO_SQUARE;
+    fill(this->entries.begin(), this->entries.end(), empty);
+    this->probes = 0;
+    this->hits = 0;
+}
+
+// Public Method: probe
+// ====================
+// Takes a Position and returns the PawnEntry for its Pawns,
+// evaluating them first if they are not in the table.
+PawnEntry& PawnTable::probe(const Position& position) {
+    Key key = position.getPawnKey();
+    PawnEntry& entry = this->entries[key & (PAWN_TABLE_SIZE - 1)];
+    ++this->probes;
+    if (entry.key == key) {
+        ++this->hits;
+        return entry;
+    }
+    entry.key = key;
+    entry.kingSquares[White] = NO_SQUARE;
+    entry.kingSquares[Black] = NO_SQUARE;
+    evaluatePawns(position, entry);
+    return entry;
+}
+
+// Private Method: evaluatePawns
+// =============================
+// Fills in the given PawnEntry from the Pawns of the Position. A Pawn
+// is doubled if another Pawn of its side stands ahead of it on its
+// file, isolated if its side has no Pawn on the adjacent files, and
+// backward if none of those Pawns can ever come up to defend it and
+// an enemy Pawn controls the square in front of it. It is passed if
+// no enemy Pawn stands ahead of it on its own or the adjacent files.
+void PawnTable::evaluatePawns(const Position& position, PawnEntry& entry) {
+    int mgScore = 0;
+    int egScore = 0;
+    for (int color = White; color <= Black; ++color) {
+        Color us = static_cast<Color>(color);
+        Color them = flip(us);
+        Bitboard ours = position.getPieces(us, PawnType);
+        Bitboard theirs = position.getPieces(them, PawnType);
+        int sign = (us == White) ? 1 : -1;
+        int mg = 0;
+        int eg = 0;
+
+        entry.passedPawns[us] = EMPTY_BITBOARD;
+        Bitboard pawns = ours;
+        while (pawns) {
+            int square = popLsb(pawns);
+            int rank = squareRank(square);
+            int relativeRank = (us == White) ? rank - BOTTOM_RANK
+                                             : TOP_RANK - rank;
+            Bitboard neighbours = ours & ADJACENT_FILES[square];
+
+            if (ours & FORWARD_FILE[us][square]) {
+                mg -= DOUBLED_PAWN_MG;
+                eg -= DOUBLED_PAWN_EG;
+            }
+            if (!neighbours) {
+                mg -= ISOLATED_PAWN_MG;
+                eg -= ISOLATED_PAWN_EG;
+            } else if (rank != TOP_RANK && rank != BOTTOM_RANK &&
+                       !(neighbours & ~PASSED_PAWN_MASKS[us][square])) {
+                int stop = (us == White) ? square + SIDE_LEN
+                                         : square - SIDE_LEN;
+                if (theirs & PAWN_ATTACKS[us][stop]) {
+                    mg -= BACKWARD_PAWN_MG;
+                    eg -= BACKWARD_PAWN_EG;
+                }
+            }
+            if (!(theirs & PASSED_PAWN_MASKS[us][square])) {
+                entry.passedPawns[us] |= squareBit(square);
+                mg += PASSED_PAWN_MG[relativeRank];
+                eg += PASSED_PAWN_EG[relativeRank];
+            }
+        }
+        mgScore += sign * mg;
+        egScore += sign * eg;
+    }
+    entry.mgScore = static_cast<int16_t>(mgScore);
+    entry.egScore = static_cast<int16_t>(egScore);
+}
+
+// Public Method: getShield
+// ========================
+// Takes the PawnEntry returned by probe for a Position and a Color,
+// and returns the middlegame bonus for the Pawns of that Color on the
+// King's file and the adjacent files one and two ranks in front of it.
+int PawnTable::getShield(PawnEntry& entry, const Position& position,
+                         Color color) {
+    int kingSquare = position.getKingSquare(color);
+    if (entry.kingSquares[color] == kingSquare) return entry.shields[color];
+
+    Bitboard files = FORWARD_FILE[color][kingSquare] |
+                     (PASSED_PAWN_MASKS[color][kingSquare] &
+                      ADJACENT_FILES[kingSquare]);
+    Bitboard pawns = position.getPieces(color, PawnType) & files;
+    int shield = 0;
+    while (pawns) {
+        int square = popLsb(pawns);
+        int distance = squareRank(square) - squareRank(kingSquare);
+        if (distance < 0) distance = -distance;
+        if (distance <= 2) shield += PAWN_SHIELD_MG[distance];
+    }
+    entry.kingSquares[color] = static_cast<int8_t>(kingSquare);
+    entry.shields[color] = static_cast<int16_t>(shield);
+    return shield;
+}
+
+// Public Method: getProbes
+// ========================
+// Returns the number of calls to probe since the last clear.
+unsigned long long PawnTable::getProbes() const {
+    return this->probes;
+}
+
+// Public Method: getHits
+// ======================
+// Returns how many of those found their entry in the table.
+unsigned long long PawnTable::getHits() const {
+    return this->hits;
+}
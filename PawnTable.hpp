@@ -0,0 +1,90 @@
+// ==========================================
+// File:    PawnTable.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef PAWN_TABLE_HPP
+#define PAWN_TABLE_HPP
+
+#include <cstdint>
+#include <vector>
+using namespace std;
+
+#include "Position.hpp"
+
+// Struct: PawnEntry
+// =================
+// Holds the evaluation of the Pawns of a Position, which only depends
+// on where the Pawns stand, along with the passed Pawns of each side
+// for the rest of the Evaluation to use. The pawn shield of a King
+// also depends on the square of that King, so it is kept along with
+// the square it was computed for and worked out again if it moves.
+struct PawnEntry {
+    Key key;                    // Pawn key of the Position.
+    Bitboard passedPawns[2];    // Passed Pawns of each Color.
+    int16_t mgScore;            // Middlegame score, White's view.
+    int16_t egScore;            // Endgame score, White's view.
+    int16_t shields[2];         // Pawn shield of each King.
+    int8_t kingSquares[2];      // Squares the shields are for.
+};
+
+// Class: PawnTable
+// ================
+// This class defines a hash table of PawnEntry indexed by the pawn key
+// of a Position. Pawns move rarely compared to the other pieces, so
+// most positions met by the Search share their Pawns with one met
+// before and the pawn structure is almost never evaluated from scratch.
+// Each Evaluation has its own PawnTable, so no locking is needed.
+class PawnTable {
+
+    private:
+
+        vector<PawnEntry> entries;  // PAWN_TABLE_SIZE entries.
+        unsigned long long probes;  // Number of calls to probe.
+        unsigned long long hits;    // Of which found in the table.
+
+        // Method: evaluatePawns
+        // =====================
+        // Fills in the given PawnEntry from the Pawns of the Position.
+        static void evaluatePawns(const Position& position,
+                                  PawnEntry& entry);
+
+    public:
+
+        // Constructor: Default
+        // ====================
+        // Constructs an empty PawnTable.
+        PawnTable();
+
+        // Method: clear
+        // =============
+        // Empties the table and resets its statistics.
+        void clear();
+
+        // Method: probe
+        // =============
+        // Takes a Position and returns the PawnEntry for its Pawns,
+        // evaluating them first if they are not in the table.
+        PawnEntry& probe(const Position& position);
+
+        // Method: getShield
+        // =================
+        // Takes the PawnEntry returned by probe for a Position and a
+        // Color, and returns the middlegame bonus for the Pawns in
+        // front of the King of that Color.
+        static int getShield(PawnEntry& entry, const Position& position,
+                             Color color);
+
+        // Method: getProbes
+        // =================
+        // Returns the number of calls to probe since the last clear.
+        unsigned long long getProbes() const;
+
+        // Method: getHits
+        // ===============
+        // Returns how many of those found their entry in the table.
+        unsigned long long getHits() const;
+};
+
+#endif
@@ -0,0 +1,207 @@
+// ==========================================
+// File:    PerftCheck.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <iostream>
+#include <string>
+using namespace std;
+
+#include "ChessBoard.hpp"
+#include "MoveGenerator.hpp"
+#include "Termination.hpp"
+
+// Struct: PerftCase
+// =================
+// A position to walk the move tree of, to the given depth.
+struct PerftCase {
+    const char* fen;
+    int depth;
+};
+
+// Enum: Verdict
+// =============
+// Whether the side to move in a position can move, and if it cannot,
+// whether it is checkmated or stalemated.
+enum Verdict {CanMoveVerdict, CheckmateVerdict, StalemateVerdict};
+
+// Struct: VerdictCase
+// ===================
+// A position along with the Verdict it is known to have.
+struct VerdictCase {
+    const char* fen;
+    Verdict verdict;
+};
+
+// Lookup Table: PERFT_CASES
+// =========================
+// Positions full of checks, double checks and pins, whose move trees
+// are walked. They have no castling rights, as the engine has none.
+const PerftCase PERFT_CASES[] = {
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w - - 0 1", 4},
+    {"r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w - - 0 1",
+     3},
+    {"8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1", 5},
+    {"r3k2r/Pppp1ppp/1b3nbN/nP6/BBP1P3/q4N2/Pp1P2PP/R2Q1RK1 w - - 0 1", 3},
+    {"rnbq1k1r/pp1Pbppp/2p5/8/2B5/8/PPP1NnPP/RNBQK2R w - - 0 1", 3}
+};
+
+// Lookup Table: VERDICT_CASES
+// ===========================
+// Positions whose side to move is known to be checkmated, stalemated
+// or to have a way out, e.g. by a block or a capture of the checker.
+const VerdictCase VERDICT_CASES[] = {
+    {"rnb1kbnr/pppp1ppp/8/4p3/6Pq/5P2/PPPPP2P/RNBQKBNR w - - 0 1",
+     CheckmateVerdict},
+    {"6rk/5Npp/8/8/8/8/8/6K1 b - - 0 1", CheckmateVerdict},
+    {"3qkb2/5p2/8/1B6/8/8/8/4R2K b - - 0 1", CheckmateVerdict},
+    {"4k3/8/8/8/8/8/3PPP2/r3K3 w - - 0 1", CheckmateVerdict},
+    {"4k3/8/8/8/8/1N6/3PPP2/r3K3 w - - 0 1", CanMoveVerdict},
+    {"4k3/8/8/8/8/4N3/3PPP2/r3K3 w - - 0 1", CanMoveVerdict},
+    {"7k/5Q2/6K1/8/8/8/8/8 b - - 0 1", StalemateVerdict},
+    {"k7/8/1Q6/8/8/8/8/7K b - - 0 1", StalemateVerdict},
+    {"rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w - - 0 1",
+     CanMoveVerdict}
+};
+
+// Function: generateReference
+// ===========================
+// Takes a Position and fills the MoveList with its legal moves, found
+// the slow way: every pseudo-legal move is played, and kept if it does
+// not leave the King of the side that played it in check.
+static void generateReference(Position& position, MoveList& moves) {
+    Color us = position.getSideToMove();
+    MoveList candidates;
+    MoveGenerator(position).generateAll(candidates);
+    moves.clear();
+    for (Move move : candidates) {
+        UndoInfo undo;
+        position.makeMove(move, undo);
+        if (!position.isInCheck(us)) moves.add(move);
+        position.unmakeMove(move, undo);
+    }
+}
+
+// Function: isSameMoves
+// =====================
+// Returns true if both MoveLists hold the same moves, in any order.
+static bool isSameMoves(const MoveList& first, const MoveList& second) {
+    if (first.size() != second.size()) return false;
+    for (Move move : first) {
+        if (!second.contains(move)) return false;
+    }
+    return true;
+}
+
+// Function: perft
+// ===============
+// Takes a Position and a depth and returns the number of leaves of its
+// move tree to that depth, as counted by generateLegal. At every node
+// the moves of generateLegal and the answer of hasLegalMove are checked
+// against the slow reference, and failures counts the nodes where they
+// do not agree.
+static long perft(Position& position, int depth, long& failures) {
+    MoveList moves;
+    MoveList reference;
+    MoveGenerator(position).generateLegal(moves);
+    generateReference(position, reference);
+    if (!isSameMoves(moves, reference) ||
+        hasLegalMove(position) != !reference.isEmpty()) {
+        ++failures;
+    }
+    if (depth == 0) return 1;
+
+    long nodes = 0;
+    for (Move move : moves) {
+        UndoInfo undo;
+        position.makeMove(move, undo);
+        nodes += perft(position, depth - 1, failures);
+        position.unmakeMove(move, undo);
+    }
+    return nodes;
+}
+
+// Function: perftReference
+// ========================
+// Takes a Position and a depth and returns the number of leaves of its
+// move tree to that depth, as counted by the slow reference alone.
+static long perftReference(Position& position, int depth) {
+    if (depth == 0) return 1;
+    MoveList moves;
+    generateReference(position, moves);
+    long nodes = 0;
+    for (Move move : moves) {
+        UndoInfo undo;
+        position.makeMove(move, undo);
+        nodes += perftReference(position, depth - 1);
+        position.unmakeMove(move, undo);
+    }
+    return nodes;
+}
+
+// Function: getVerdict
+// ====================
+// Returns the Verdict for the side to move, as decided by hasLegalMove.
+static Verdict getVerdict(const Position& position) {
+    if (hasLegalMove(position)) return CanMoveVerdict;
+    if (position.isInCheck(position.getSideToMove())) {
+        return CheckmateVerdict;
+    }
+    return StalemateVerdict;
+}
+
+// Function: readPosition
+// ======================
+// Takes a FEN and sets up the Position from it. Returns false if the
+// FEN is rejected.
+static bool readPosition(const string& fen, Position& position) {
+    ChessBoard board(true);
+    if (!board.setPosition(fen)) return false;
+    position = board.getPosition();
+    return true;
+}
+
+int main() {
+    int failed = 0;
+
+    // Walk each move tree, comparing generateLegal, hasLegalMove and
+    // the number of leaves with the slow reference.
+    for (const PerftCase& test : PERFT_CASES) {
+        Position position;
+        long failures = 0;
+        long nodes = 0;
+        long expected = 0;
+        bool isRead = readPosition(test.fen, position);
+        if (isRead) {
+            nodes = perft(position, test.depth, failures);
+            expected = perftReference(position, test.depth);
+        }
+        bool isPassed = isRead && failures == 0 && nodes == expected;
+        if (!isPassed) ++failed;
+        cout << (isPassed ? "ok     " : "FAILED ") << "perft " << test.depth
+             << " " << nodes << "/" << expected << " " << test.fen << endl;
+    }
+
+    // Make sure each known position gets its Verdict.
+    for (const VerdictCase& test : VERDICT_CASES) {
+        Position position;
+        bool isPassed = readPosition(test.fen, position) &&
+                        getVerdict(position) == test.verdict;
+        if (isPassed) {
+            MoveList reference;
+            generateReference(position, reference);
+            isPassed = reference.isEmpty() == (test.verdict !=
+                                               CanMoveVerdict);
+        }
+        if (!isPassed) ++failed;
+        cout << (isPassed ? "ok     " : "FAILED ") << "verdict "
+             << test.fen << endl;
+    }
+
+    if (failed > 0) {
+        cout << failed << " check(s) failed" << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,149 @@
+// ==========================================
+// File:    PieceSquareTables.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include "PieceSquareTables.hpp"
+#include "Position.hpp"
+
+// Piece-Square Tables
+// ===================
+int PSQ_MG[16][NUM_SQUARES];
+int PSQ_EG[16][NUM_SQUARES];
+
+// Bonus Tables
+// ============
+// The positional bonus of each PieceType on each square for White.
+// They are laid out as the board is printed, with the eighth rank
+// first, so the entry for a square is at index (square ^ 56). Pawns
+// do not promote, so they are only rewarded moderately for advancing.
+static const int PAWN_MG_TABLE[NUM_SQUARES] = {
+      0,   0,   0,   0,   0,   0,   0,   0,
+     20,  20,  20,  20,  20,  20,  20,  20,
+     10,  10,  20,  30,  30,  20,  10,  10,
+      5,   5,  10,  25,  25,  10,   5,   5,
+      0,   0,   0,  20,  20,   0,   0,   0,
+      5,  -5, -10,   0,   0, -10,  -5,   5,
+      5,  10,  10, -20, -20,  10,  10,   5,
+      0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const int PAWN_EG_TABLE[NUM_SQUARES] = {
+      0,   0,   0,   0,   0,   0,   0,   0,
+     30,  30,  30,  30,  30,  30,  30,  30,
+     20,  20,  20,  20,  20,  20,  20,  20,
+     10,  10,  10,  10,  10,  10,  10,  10,
+      5,   5,   5,   5,   5,   5,   5,   5,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0
+};
+
+static const int KNIGHT_TABLE[NUM_SQUARES] = {
+    -50, -40, -30, -30, -30, -30, -40, -50,
+    -40, -20,   0,   0,   0,   0, -20, -40,
+    -30,   0,  10,  15,  15,  10,   0, -30,
+    -30,   5,  15,  20,  20,  15,   5, -30,
+    -30,   0,  15,  20,  20,  15,   0, -30,
+    -30,   5,  10,  15,  15,  10,   5, -30,
+    -40, -20,   0,   5,   5,   0, -20, -40,
+    -50, -40, -30, -30, -30, -30, -40, -50
+};
+
+static const int BISHOP_TABLE[NUM_SQUARES] = {
+    -20, -10, -10, -10, -10, -10, -10, -20,
+    -10,   0,   0,   0,   0,   0,   0, -10,
+    -10,   0,   5,  10,  10,   5,   0, -10,
+    -10,   5,   5,  10,  10,   5,   5, -10,
+    -10,   0,  10,  10,  10,  10,   0, -10,
+    -10,  10,  10,  10,  10,  10,  10, -10,
+    -10,   5,   0,   0,   0,   0,   5, -10,
+    -20, -10, -10, -10, -10, -10, -10, -20
+};
+
+static const int ROOK_TABLE[NUM_SQUARES] = {
+      0,   0,   0,   0,   0,   0,   0,   0,
+      5,  10,  10,  10,  10,  10,  10,   5,
+     -5,   0,   0,   0,   0,   0,   0,  -5,
+     -5,   0,   0,   0,   0,   0,   0,  -5,
+     -5,   0,   0,   0,   0,   0,   0,  -5,
+     -5,   0,   0,   0,   0,   0,   0,  -5,
+     -5,   0,   0,   0,   0,   0,   0,  -5,
+      0,   0,   0,   5,   5,   0,   0,   0
+};
+
+static const int QUEEN_TABLE[NUM_SQUARES] = {
+    -20, -10, -10,  -5,  -5, -10, -10, -20,
+    -10,   0,   0,   0,   0,   0,   0, -10,
+    -10,   0,   5,   5,   5,   5,   0, -10,
+     -5,   0,   5,   5,   5,   5,   0,  -5,
+      0,   0,   5,   5,   5,   5,   0,  -5,
+    -10,   5,   5,   5,   5,   5,   0, -10,
+    -10,   0,   5,   0,   0,   0,   0, -10,
+    -20, -10, -10,  -5,  -5, -10, -10, -20
+};
+
+static const int KING_MG_TABLE[NUM_SQUARES] = {
+    -30, -40, -40, -50, -50, -40, -40, -30,
+    -30, -40, -40, -50, -50, -40, -40, -30,
+    -30, -40, -40, -50, -50, -40, -40, -30,
+    -30, -40, -40, -50, -50, -40, -40, -30,
+    -20, -30, -30, -40, -40, -30, -30, -20,
+    -10, -20, -20, -20, -20, -20, -20, -10,
+     20,  20,   0,   0,   0,   0,  20,  20,
+     20,  30,  10,   0,   0,  10,  30,  20
+};
+
+static const int KING_EG_TABLE[NUM_SQUARES] = {
+    -50, -40, -30, -20, -20, -30, -40, -50,
+    -30, -20, -10,   0,   0, -10, -20, -30,
+    -30, -10,  20,  30,  30,  20, -10, -30,
+    -30, -10,  30,  40,  40,  30, -10, -30,
+    -30, -10,  30,  40,  40,  30, -10, -30,
+    -30, -10,  20,  30,  30,  20, -10, -30,
+    -30, -30,   0,   0,   0,   0, -30, -30,
+    -50, -30, -30, -30, -30, -30, -30, -50
+};
+
+// Function: initPieceSquareTables
+// ===============================
+// Fills in PSQ_MG and PSQ_EG from the bonus tables and the
+// middlegame and endgame values of each PieceType.
+static void initPieceSquareTables() {
+    const int* mgTables[6] = {PAWN_MG_TABLE, KNIGHT_TABLE, BISHOP_TABLE,
+                              ROOK_TABLE, QUEEN_TABLE, KING_MG_TABLE};
+    const int* egTables[6] = {PAWN_EG_TABLE, KNIGHT_TABLE, BISHOP_TABLE,
+                              ROOK_TABLE, QUEEN_TABLE, KING_EG_TABLE};
+
+    for (int piece = 0; piece < 16; ++piece) {
+        for (int square = 0; square < NUM_SQUARES; ++square) {
+            PSQ_MG[piece][square] = 0;
+            PSQ_EG[piece][square] = 0;
+        }
+    }
+
+    // Black's entries mirror White's vertically and are negated.
+    for (int type = PawnType; type <= KingType; ++type) {
+        Piece white = makePiece(White, static_cast<PieceType>(type));
+        Piece black = makePiece(Black, static_cast<PieceType>(type));
+        for (int square = 0; square < NUM_SQUARES; ++square) {
+            int mg = MG_PIECE_VALUES[type] + mgTables[type][square ^ 56];
+            int eg = EG_PIECE_VALUES[type] + egTables[type][square ^ 56];
+            PSQ_MG[white][square] = mg;
+            PSQ_EG[white][square] = eg;
+            PSQ_MG[black][square ^ 56] = -mg;
+            PSQ_EG[black][square ^ 56] = -eg;
+        }
+    }
+}
+
+// Struct: PieceSquareTablesInitialiser
+// ====================================
+// A single static instance of this struct fills in
+// the piece-square tables before main is entered.
+static struct PieceSquareTablesInitialiser {
+    PieceSquareTablesInitialiser() {
+        initPieceSquareTables();
+    }
+} pieceSquareTablesInitialiser;
@@ -0,0 +1,27 @@
+// ==========================================
+// File:    PieceSquareTables.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef PIECE_SQUARE_TABLES_HPP
+#define PIECE_SQUARE_TABLES_HPP
+
+#include <string>
+using namespace std;
+
+#include "Settings.hpp"
+
+// Piece-Square Tables
+// ===================
+// These tables give the score, in centipawns and from White's point
+// of view, of having a given Piece on a given square, in the middlegame
+// (MG) and in the endgame (EG). Each entry already includes the value
+// of the Piece itself, and the entries of Black's Pieces are negated,
+// so that the score of a Position is just the sum of the entries of
+// its Pieces. They are indexed by Piece, as defined in Position.hpp,
+// and are filled in once when the program starts.
+extern int PSQ_MG[16][NUM_SQUARES];
+extern int PSQ_EG[16][NUM_SQUARES];
+
+#endif
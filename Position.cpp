@@ -0,0 +1,400 @@
+// ==========================================
+// File:    Position.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <algorithm>
+using namespace std;
+
+#include "Position.hpp"
+#include "PieceSquareTables.hpp"
+
+// Zobrist Keys
+// ============
+// A random Key for every Piece on every square, and one more that is
+// toggled whenever the side to move changes. The Key of a Position is
+// the exclusive or of the Keys of all of its features.
+static Key PIECE_KEYS[16][NUM_SQUARES];
+static Key SIDE_KEY;
+
+// Function: nextRandom
+// ====================
+// A xorshift64* generator. A fixed seed keeps
+// the Keys identical from one run to the next.
+static Key nextRandom() {
+    static Key state = 0x9E3779B97F4A7C15ULL;
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 0x2545F4914F6CDD1DULL;
+}
+
+// Struct: ZobristInitialiser
+// ==========================
+// A single static instance of this struct fills
+// in the Zobrist Keys before main is entered.
+static struct ZobristInitialiser {
+    ZobristInitialiser() {
+        for (int piece = 0; piece < 16; ++piece) {
+            for (int square = 0; square < NUM_SQUARES; ++square) {
+                PIECE_KEYS[piece][square] = nextRandom();
+            }
+        }
+        SIDE_KEY = nextRandom();
+    }
+} zobristInitialiser;
+
+// Constructor: Default
+// ====================
+// Constructs an empty Position with White to move.
+Position::Position() {
+    this->clear();
+}
+
+// Public Method: clear
+// ====================
+// Removes every Piece and gives the move to White.
+void Position::clear() {
+    fill(this->board, this->board + NUM_SQUARES, NO_PIECE);
+    fill(this->byColor, this->byColor + 2, EMPTY_BITBOARD);
+    fill(this->byType, this->byType + 6, EMPTY_BITBOARD);
+    this->key = 0;
+    this->pawnKey = 0;
+    this->sideToMove = White;
+    this->mgScore = 0;
+    this->egScore = 0;
+    this->phase = 0;
+}
+
+// Public Method: setStartPosition
+// ===============================
+// Sets up the pieces on their starting squares, following
+// the same layout as the one used by ChessSet.
+void Position::setStartPosition() {
+    const PieceType backRank[SIDE_LEN] = {RookType, KnightType, BishopType,
+                                          QueenType, KingType, BishopType,
+                                          KnightType, RookType};
+    this->clear();
+    for (int i = 0; i < SIDE_LEN; ++i) {
+        char file = LEFTMOST_FILE + i;
+        this->addPiece(White, backRank[i], squareIndex(file, BOTTOM_RANK));
+        this->addPiece(White, PawnType, squareIndex(file, WHITE_PAWNS));
+        this->addPiece(Black, PawnType, squareIndex(file, BLACK_PAWNS));
+        this->addPiece(Black, backRank[i], squareIndex(file, TOP_RANK));
+    }
+}
+
+// Public Method: addPiece
+// =======================
+// Takes a Color, a PieceType and the index of an empty square and
+// places a new Piece there. Used to set up a Position.
+void Position::addPiece(Color color, PieceType type, int square) {
+    this->putPiece(makePiece(color, type), square);
+}
+
+// Public Method: setSideToMove
+// ============================
+// Sets the Color of the player to move.
+void Position::setSideToMove(Color color) {
+    if (color != this->sideToMove) {
+        this->sideToMove = color;
+        this->key ^= SIDE_KEY;
+    }
+}
+
+// Private Method: putPiece
+// ========================
+// Places a Piece on an empty square.
+void Position::putPiece(Piece piece, int square) {
+    Bitboard bit = squareBit(square);
+    this->board[square] = piece;
+    this->byColor[colorOf(piece)] |= bit;
+    this->byType[typeOf(piece)] |= bit;
+    this->key ^= PIECE_KEYS[piece][square];
+    if (typeOf(piece) == PawnType) this->pawnKey ^= PIECE_KEYS[piece][square];
+    this->mgScore += PSQ_MG[piece][square];
+    this->egScore += PSQ_EG[piece][square];
+    this->phase += PHASE_WEIGHTS[typeOf(piece)];
+}
+
+// Private Method: removePiece
+// ===========================
+// Removes the Piece on the given square.
+void Position::removePiece(int square) {
+    Bitboard bit = squareBit(square);
+    Piece piece = this->board[square];
+    this->board[square] = NO_PIECE;
+    this->byColor[colorOf(piece)] ^= bit;
+    this->byType[typeOf(piece)] ^= bit;
+    this->key ^= PIECE_KEYS[piece][square];
+    if (typeOf(piece) == PawnType) this->pawnKey ^= PIECE_KEYS[piece][square];
+    this->mgScore -= PSQ_MG[piece][square];
+    this->egScore -= PSQ_EG[piece][square];
+    this->phase -= PHASE_WEIGHTS[typeOf(piece)];
+}
+
+// Private Method: movePiece
+// =========================
+// Moves the Piece on the from square to the empty to square.
+void Position::movePiece(int from, int to) {
+    Bitboard bits = squareBit(from) | squareBit(to);
+    Piece piece = this->board[from];
+    this->board[from] = NO_PIECE;
+    this->board[to] = piece;
+    this->byColor[colorOf(piece)] ^= bits;
+    this->byType[typeOf(piece)] ^= bits;
+    this->key ^= PIECE_KEYS[piece][from] ^ PIECE_KEYS[piece][to];
+    if (typeOf(piece) == PawnType) {
+        this->pawnKey ^= PIECE_KEYS[piece][from] ^ PIECE_KEYS[piece][to];
+    }
+    this->mgScore += PSQ_MG[piece][to] - PSQ_MG[piece][from];
+    this->egScore += PSQ_EG[piece][to] - PSQ_EG[piece][from];
+}
+
+// Public Method: attackersTo
+// ==========================
+// Takes the index of a square and a set of occupied squares and
+// returns the squares of all Pieces of either Color attacking it.
+Bitboard Position::attackersTo(int square, Bitboard occupied) const {
+    Bitboard diagonals = this->byType[BishopType] | this->byType[QueenType];
+    Bitboard lines = this->byType[RookType] | this->byType[QueenType];
+    return (PAWN_ATTACKS[Black][square] & this->getPieces(White, PawnType))
+         | (PAWN_ATTACKS[White][square] & this->getPieces(Black, PawnType))
+         | (KNIGHT_ATTACKS[square] & this->byType[KnightType])
+         | (KING_ATTACKS[square] & this->byType[KingType])
+         | (bishopAttacks(square, occupied) & diagonals)
+         | (rookAttacks(square, occupied) & lines);
+}
+
+// Public Method: isAttacked
+// =========================
+// Returns true if the given square is attacked by any
+// Piece of the given Color. The cheap lookups are tried
+// before the sliding attacks.
+bool Position::isAttacked(int square, Color color) const {
+    Bitboard them = this->byColor[color];
+    if ((PAWN_ATTACKS[flip(color)][square] & them & this->byType[PawnType]) ||
+        (KNIGHT_ATTACKS[square] & them & this->byType[KnightType]) ||
+        (KING_ATTACKS[square] & them & this->byType[KingType])) {
+        return true;
+    }
+    Bitboard occupied = this->getPieces();
+    Bitboard queens = this->byType[QueenType];
+    return (bishopAttacks(square, occupied) & them &
+            (this->byType[BishopType] | queens)) ||
+           (rookAttacks(square, occupied) & them &
+            (this->byType[RookType] | queens));
+}
+
+// Public Method: attackedBy
+// =========================
+// Returns every square attacked by a Piece of the given Color. The
+// attacks of all its Pawns are found at once by shifting the Pawn
+// Bitboard towards each diagonal, the edge files being masked to stop
+// wrapping, and those of the other Pieces are looked up one by one.
+Bitboard Position::attackedBy(Color color) const {
+    Bitboard pawns = this->getPieces(color, PawnType);
+    Bitboard attacks;
+    if (color == White) {
+        attacks = ((pawns & ~FILE_A_BITBOARD) << (SIDE_LEN - 1)) |
+                  ((pawns & ~FILE_H_BITBOARD) << (SIDE_LEN + 1));
+    } else {
+        attacks = ((pawns & ~FILE_A_BITBOARD) >> (SIDE_LEN + 1)) |
+                  ((pawns & ~FILE_H_BITBOARD) >> (SIDE_LEN - 1));
+    }
+
+    Bitboard occupied = this->getPieces();
+    Bitboard queens = this->getPieces(color, QueenType);
+    Bitboard pieces = this->getPieces(color, KnightType);
+    while (pieces) attacks |= KNIGHT_ATTACKS[popLsb(pieces)];
+    pieces = this->getPieces(color, BishopType) | queens;
+    while (pieces) attacks |= bishopAttacks(popLsb(pieces), occupied);
+    pieces = this->getPieces(color, RookType) | queens;
+    while (pieces) attacks |= rookAttacks(popLsb(pieces), occupied);
+    return attacks | KING_ATTACKS[this->getKingSquare(color)];
+}
+
+// Public Method: hangingPieces
+// ============================
+// Returns the squares of the Pieces of the given Color, other than
+// its King, that are attacked and not defended.
+Bitboard Position::hangingPieces(Color color) const {
+    Bitboard pieces = this->getPieces(color) & ~this->byType[KingType];
+    return pieces & this->attackedBy(flip(color)) &
+           ~this->attackedBy(color);
+}
+
+// Public Method: isPseudoLegal
+// ============================
+// Returns true if the given Move follows the rules of movement for
+// the Piece of the side to move on its source square. It does not
+// ensure that the Move doesn't leave the King in check.
+bool Position::isPseudoLegal(Move move) const {
+    int from = move.getFrom();
+    int to = move.getTo();
+    Piece piece = this->board[from];
+
+    // The source square must hold a Piece of the side to move and the
+    // destination square must not hold one of its own Pieces.
+    if (from == to || piece == NO_PIECE ||
+        colorOf(piece) != this->sideToMove ||
+        (this->byColor[this->sideToMove] & squareBit(to))) {
+        return false;
+    }
+
+    Bitboard occupied = this->getPieces();
+    Bitboard target = squareBit(to);
+    switch (typeOf(piece)) {
+
+        case PawnType: {
+
+            // Pawns only move diagonally when capturing.
+            if (this->board[to] != NO_PIECE) {
+                return PAWN_ATTACKS[this->sideToMove][from] & target;
+            }
+
+            // Otherwise they move one square forward, or two from their
+            // starting rank provided the square they pass is empty.
+            int forward = (this->sideToMove == White) ? SIDE_LEN : -SIDE_LEN;
+            int startRank = (this->sideToMove == White) ? WHITE_PAWNS
+                                                        : BLACK_PAWNS;
+            if (to == from + forward) return true;
+            return squareRank(from) == startRank &&
+                   to == from + 2 * forward &&
+                   this->board[from + forward] == NO_PIECE;
+        }
+        case KnightType:
+            return KNIGHT_ATTACKS[from] & target;
+        case BishopType:
+            return bishopAttacks(from, occupied) & target;
+        case RookType:
+            return rookAttacks(from, occupied) & target;
+        case QueenType:
+            return queenAttacks(from, occupied) & target;
+        case KingType:
+            return KING_ATTACKS[from] & target;
+        default:
+            return false;
+    }
+}
+
+// Public Method: isLegal
+// ======================
+// Takes a pseudo-legal Move and returns true if it does not leave the
+// King of the mover in check. Rather than playing the Move, it looks
+// for attackers of the King on the board as it would be after the Move.
+bool Position::isLegal(Move move) const {
+    int from = move.getFrom();
+    int to = move.getTo();
+    Color us = this->sideToMove;
+    int kingSquare = (typeOf(this->board[from]) == KingType)
+                     ? to : this->getKingSquare(us);
+
+    // Any Piece on the destination square is captured, so it
+    // cannot attack the King once the Move has been played.
+    Bitboard occupied = (this->getPieces() ^ squareBit(from)) | squareBit(to);
+    Bitboard attackers = this->attackersTo(kingSquare, occupied) &
+                         this->byColor[flip(us)] & ~squareBit(to);
+    return attackers == EMPTY_BITBOARD;
+}
+
+// Public Method: see
+// ==================
+// Static exchange evaluation. Returns the material balance, from the
+// point of view of the mover, of the sequence of captures on the
+// destination square of the given Move in which both sides always
+// recapture with their least valuable attacker and may stop capturing
+// whenever that is favourable. Sliding pieces hidden behind a capturer
+// join the exchange as soon as the capturer leaves its square.
+int Position::see(Move move) const {
+    int from = move.getFrom();
+    int to = move.getTo();
+    int gain[32];
+    int depth = 0;
+
+    Bitboard occupied = this->getPieces();
+    Bitboard attackers = this->attackersTo(to, occupied);
+    Bitboard diagonals = this->byType[BishopType] | this->byType[QueenType];
+    Bitboard lines = this->byType[RookType] | this->byType[QueenType];
+    Bitboard fromBit = squareBit(from);
+    Color side = colorOf(this->board[from]);
+    PieceType attacker = typeOf(this->board[from]);
+    gain[0] = PIECE_VALUES[typeOf(this->board[to])];
+
+    do {
+        ++depth;
+        gain[depth] = PIECE_VALUES[attacker] - gain[depth - 1];
+
+        // Neither side can gain by carrying on with the exchange.
+        if (max(-gain[depth - 1], gain[depth]) < 0) break;
+
+        // Remove the capturer and uncover any sliders behind it.
+        occupied ^= fromBit;
+        attackers |= (bishopAttacks(to, occupied) & diagonals) |
+                     (rookAttacks(to, occupied) & lines);
+        attackers &= occupied;
+
+        // Find the least valuable attacker of the other side.
+        side = flip(side);
+        fromBit = EMPTY_BITBOARD;
+        Bitboard ours = attackers & this->byColor[side];
+        for (int type = PawnType; type <= KingType; ++type) {
+            Bitboard candidates = ours & this->byType[type];
+            if (candidates) {
+                fromBit = candidates & (0 - candidates);
+                attacker = static_cast<PieceType>(type);
+                break;
+            }
+        }
+    } while (fromBit && depth < 31);
+
+    // Negamax the gains back to the root of the exchange.
+    while (--depth) {
+        gain[depth - 1] = -max(-gain[depth - 1], gain[depth]);
+    }
+    return gain[0];
+}
+
+// Public Method: makeMove
+// =======================
+// Plays the given pseudo-legal Move and stores what is
+// needed to take it back in the given UndoInfo.
+void Position::makeMove(Move move, UndoInfo& undo) {
+    int from = move.getFrom();
+    int to = move.getTo();
+    undo.captured = this->board[to];
+    if (undo.captured != NO_PIECE) this->removePiece(to);
+    this->movePiece(from, to);
+    this->sideToMove = flip(this->sideToMove);
+    this->key ^= SIDE_KEY;
+}
+
+// Public Method: unmakeMove
+// =========================
+// Takes back the given Move, which must be the last Move
+// played, using the UndoInfo filled in by makeMove.
+void Position::unmakeMove(Move move, const UndoInfo& undo) {
+    int from = move.getFrom();
+    int to = move.getTo();
+    this->sideToMove = flip(this->sideToMove);
+    this->key ^= SIDE_KEY;
+    this->movePiece(to, from);
+    if (undo.captured != NO_PIECE) this->putPiece(undo.captured, to);
+}
+
+// Public Method: makeNullMove
+// ===========================
+// Passes the turn to the opponent without moving a Piece.
+void Position::makeNullMove() {
+    this->sideToMove = flip(this->sideToMove);
+    this->key ^= SIDE_KEY;
+}
+
+// Public Method: unmakeNullMove
+// =============================
+// Takes back a null move played with makeNullMove.
+void Position::unmakeNullMove() {
+    this->sideToMove = flip(this->sideToMove);
+    this->key ^= SIDE_KEY;
+}
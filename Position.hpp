@@ -0,0 +1,300 @@
+// ==========================================
+// File:    Position.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef POSITION_HPP
+#define POSITION_HPP
+
+#include <cstdint>
+#include <string>
+using namespace std;
+
+#include "Settings.hpp"
+#include "Bitboard.hpp"
+#include "ChessPiece.hpp"
+#include "Move.hpp"
+
+// Type: Piece
+// ===========
+// A Piece packs a Color and a PieceType into a single byte, with
+// the Color in bit 3 and the PieceType in bits 0 to 2. Empty squares
+// hold NO_PIECE, whose type is NoPieceType.
+typedef unsigned char Piece;
+const Piece NO_PIECE = NoPieceType;
+
+// Type: Key
+// =========
+// A Key is the Zobrist hash of a Position.
+typedef uint64_t Key;
+
+// Function: makePiece
+// ===================
+// Takes a Color and a PieceType and returns the matching Piece.
+inline Piece makePiece(Color color, PieceType type) {
+    return static_cast<Piece>((color << 3) | type);
+}
+
+// Function: typeOf
+// ================
+// Returns the PieceType of the given Piece.
+inline PieceType typeOf(Piece piece) {
+    return static_cast<PieceType>(piece & 7);
+}
+
+// Function: colorOf
+// =================
+// Returns the Color of the given Piece.
+inline Color colorOf(Piece piece) {
+    return static_cast<Color>(piece >> 3);
+}
+
+// Function: flip
+// ==============
+// Returns the Color that is not the given Color. This is the
+// branch-free counterpart of the ! operator defined for Color.
+inline Color flip(Color color) {
+    return static_cast<Color>(color ^ Black);
+}
+
+// Struct: UndoInfo
+// ================
+// Holds what Position::makeMove cannot recover from the Move
+// alone and Position::unmakeMove needs to take the Move back.
+struct UndoInfo {
+    Piece captured;     // The Piece captured by the move, if any.
+};
+
+// Class: Position
+// ===============
+// This class defines a compact representation of the state of a game
+// of chess that is designed to be played through quickly by the search.
+// It keeps both a Piece per square and a Bitboard per Color and per
+// PieceType, together with the Zobrist hashes of the position and of
+// its Pawns alone, and the material and piece-square scores read by
+// the Evaluation. Moves are played and taken back with makeMove and
+// unmakeMove, which update all of these incrementally. A Position
+// follows the same rules as the ChessBoard: Pawns do not promote and
+// there is no castling or en passant capture. A Position holds no
+// pointers, so it can be copied freely.
+class Position {
+
+    private:
+
+        Piece board[NUM_SQUARES];   // Piece on each square.
+        Bitboard byColor[2];        // Squares occupied by each Color.
+        Bitboard byType[6];         // Squares occupied by each type.
+        Key key;                    // Zobrist hash.
+        Key pawnKey;                // Zobrist hash of the Pawns only.
+        Color sideToMove;           // Color of the player to move.
+
+        // Sums of the piece-square table entries of every Piece on the
+        // board, for the middlegame and the endgame, and the game phase.
+        int mgScore;
+        int egScore;
+        int phase;
+
+        // Method: putPiece
+        // ================
+        // Places a Piece on an empty square.
+        void putPiece(Piece piece, int square);
+
+        // Method: removePiece
+        // ===================
+        // Removes the Piece on the given square.
+        void removePiece(int square);
+
+        // Method: movePiece
+        // =================
+        // Moves the Piece on the from square to the empty to square.
+        void movePiece(int from, int to);
+
+    public:
+
+        // Constructor: Default
+        // ====================
+        // Constructs an empty Position with White to move.
+        Position();
+
+        // Method: clear
+        // =============
+        // Removes every Piece and gives the move to White.
+        void clear();
+
+        // Method: setStartPosition
+        // ========================
+        // Sets up the pieces on their starting squares.
+        void setStartPosition();
+
+        // Method: addPiece
+        // ================
+        // Takes a Color, a PieceType and the index of an empty square
+        // and places a new Piece there. Used to set up a Position.
+        void addPiece(Color color, PieceType type, int square);
+
+        // Method: setSideToMove
+        // =====================
+        // Sets the Color of the player to move.
+        void setSideToMove(Color color);
+
+        // Method: pieceOn
+        // ===============
+        // Returns the Piece on the given square, or NO_PIECE.
+        Piece pieceOn(int square) const { return this->board[square]; }
+
+        // Method: getPieces
+        // =================
+        // Returns the squares occupied by any Piece, by the Pieces of
+        // a Color, of a PieceType, or of a Color and a PieceType.
+        Bitboard getPieces() const {
+            return this->byColor[White] | this->byColor[Black];
+        }
+        Bitboard getPieces(Color color) const {
+            return this->byColor[color];
+        }
+        Bitboard getPieces(PieceType type) const {
+            return this->byType[type];
+        }
+        Bitboard getPieces(Color color, PieceType type) const {
+            return this->byColor[color] & this->byType[type];
+        }
+
+        // Method: getKingSquare
+        // =====================
+        // Returns the index of the square of the King of a Color.
+        int getKingSquare(Color color) const {
+            return lsb(this->getPieces(color, KingType));
+        }
+
+        // Method: getSideToMove
+        // =====================
+        // Returns the Color of the player to move.
+        Color getSideToMove() const { return this->sideToMove; }
+
+        // Method: getKey
+        // ==============
+        // Returns the Zobrist hash of this Position.
+        Key getKey() const { return this->key; }
+
+        // Method: getPawnKey
+        // ==================
+        // Returns the Zobrist hash of the Pawns of this Position,
+        // which only changes when a Pawn moves or is captured.
+        Key getPawnKey() const { return this->pawnKey; }
+
+        // Method: getMgScore
+        // ==================
+        // Returns the middlegame material and piece-square
+        // score of this Position from White's point of view.
+        int getMgScore() const { return this->mgScore; }
+
+        // Method: getEgScore
+        // ==================
+        // Returns the endgame material and piece-square
+        // score of this Position from White's point of view.
+        int getEgScore() const { return this->egScore; }
+
+        // Method: getPhase
+        // ================
+        // Returns the game phase, which is MAX_PHASE with all
+        // pieces on the board and falls as pieces are traded.
+        int getPhase() const { return this->phase; }
+
+        // Method: hasNonPawnMaterial
+        // ==========================
+        // Returns true if the given Color has any Piece
+        // other than its King and its Pawns.
+        bool hasNonPawnMaterial(Color color) const {
+            return (this->byColor[color] & ~this->byType[PawnType] &
+                    ~this->byType[KingType]) != EMPTY_BITBOARD;
+        }
+
+        // Method: attackersTo
+        // ===================
+        // Takes the index of a square and a set of occupied squares and
+        // returns the squares of all Pieces of either Color attacking it.
+        Bitboard attackersTo(int square, Bitboard occupied) const;
+
+        // Method: isAttacked
+        // ==================
+        // Returns true if the given square is attacked by any
+        // Piece of the given Color.
+        bool isAttacked(int square, Color color) const;
+
+        // Method: attackersOf
+        // ===================
+        // Takes the index of a square and a Color and returns the
+        // squares of the Pieces of that Color attacking it.
+        Bitboard attackersOf(int square, Color color) const {
+            return this->attackersTo(square, this->getPieces()) &
+                   this->byColor[color];
+        }
+
+        // Method: attackedBy
+        // ==================
+        // Returns every square attacked by a Piece of the given Color,
+        // including the squares of its own Pieces that it defends.
+        Bitboard attackedBy(Color color) const;
+
+        // Method: hangingPieces
+        // =====================
+        // Returns the squares of the Pieces of the given Color, other
+        // than its King, that are attacked and not defended.
+        Bitboard hangingPieces(Color color) const;
+
+        // Method: isInCheck
+        // =================
+        // Returns true if the King of the given Color is attacked.
+        bool isInCheck(Color color) const {
+            return this->isAttacked(this->getKingSquare(color),
+                                    flip(color));
+        }
+
+        // Method: isPseudoLegal
+        // =====================
+        // Returns true if the given Move follows the rules of movement
+        // for the Piece of the side to move on its source square. It
+        // does not ensure that the Move doesn't leave the King in check.
+        bool isPseudoLegal(Move move) const;
+
+        // Method: isLegal
+        // ===============
+        // Takes a pseudo-legal Move and returns true if
+        // it does not leave the King of the mover in check.
+        bool isLegal(Move move) const;
+
+        // Method: see
+        // ===========
+        // Static exchange evaluation. Returns the material balance, from
+        // the point of view of the mover, of the sequence of captures on
+        // the destination square of the given Move in which both sides
+        // always recapture with their least valuable attacker and may
+        // stop capturing whenever that is favourable.
+        int see(Move move) const;
+
+        // Method: makeMove
+        // ================
+        // Plays the given pseudo-legal Move and stores what is
+        // needed to take it back in the given UndoInfo.
+        void makeMove(Move move, UndoInfo& undo);
+
+        // Method: unmakeMove
+        // ==================
+        // Takes back the given Move, which must be the last Move
+        // played, using the UndoInfo filled in by makeMove.
+        void unmakeMove(Move move, const UndoInfo& undo);
+
+        // Method: makeNullMove
+        // ====================
+        // Passes the turn to the opponent without moving a Piece.
+        // Used by the search; must not be played when in check.
+        void makeNullMove();
+
+        // Method: unmakeNullMove
+        // ======================
+        // Takes back a null move played with makeNullMove.
+        void unmakeNullMove();
+};
+
+#endif
@@ -0,0 +1,75 @@
+// ==========================================
+// File:    PremoveQueue.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef PREMOVE_QUEUE_HPP
+#define PREMOVE_QUEUE_HPP
+
+#include <string>
+using namespace std;
+
+#include "Settings.hpp"
+#include "Move.hpp"
+
+// Class: PremoveQueue
+// ===================
+// This class holds the moves a player has queued up to be played as
+// soon as it is their turn, first in first out, in a fixed ring of
+// MAX_PREMOVES moves, so queueing and playing them never allocates.
+class PremoveQueue {
+
+    private:
+
+        Move moves[MAX_PREMOVES];   // Ring of the queued moves.
+        int head;                   // Index of the oldest one.
+        int size;                   // Number of moves queued.
+
+    public:
+
+        // Constructor: Default
+        // ====================
+        // Constructs an empty PremoveQueue.
+        PremoveQueue() : head(0), size(0) {}
+
+        // Method: push
+        // ============
+        // Takes a Move and queues it. Returns false if the queue is full.
+        bool push(Move move) {
+            if (this->size == MAX_PREMOVES) return false;
+            this->moves[(this->head + this->size++) % MAX_PREMOVES] = move;
+            return true;
+        }
+
+        // Method: pop
+        // ===========
+        // Removes the oldest Move from a queue that is not empty
+        // and returns it.
+        Move pop() {
+            Move move = this->moves[this->head];
+            this->head = (this->head + 1) % MAX_PREMOVES;
+            --this->size;
+            return move;
+        }
+
+        // Method: clear
+        // =============
+        // Removes every Move from the queue.
+        void clear() {
+            this->head = 0;
+            this->size = 0;
+        }
+
+        // Method: isEmpty
+        // ===============
+        // Returns true if no Move is queued.
+        bool isEmpty() const { return this->size == 0; }
+
+        // Method: getSize
+        // ===============
+        // Returns the number of moves queued.
+        int getSize() const { return this->size; }
+};
+
+#endif
@@ -12,14 +12,15 @@ using namespace std;
 
 // Constructor: Default
 // ====================
-Queen::Queen() : ChessPiece() {}
+Queen::Queen() : ChessPiece() {
+    this->type = QueenType;
+}
 
 // Constructor:
 // ============
 // This constructor takes a Color and creates a Queen of that Color.
 Queen::Queen(Color color) : ChessPiece(color) {
-    this->name = QUEEN_NAME;
-    this->initSymbol(color);
+    this->type = QueenType;
 }
 
 // Constructor:
@@ -28,22 +29,13 @@ Queen::Queen(Color color) : ChessPiece(color) {
 // constructs a Queen of that Color, setting its square
 // property to point to the given ChessSquare.
 Queen::Queen(Color c, const ChessSquare& cs) : ChessPiece(c, cs) {
-    this->name = QUEEN_NAME;
-    this->initSymbol(c);
+    this->type = QueenType;
 }
 
 // Destructor:
 // ===========
 Queen::~Queen() {}
 
-// Private Method: initSymbol
-// ==========================
-// This method initialises the symbol
-// property of the Queen given its Color.
-void Queen::initSymbol(Color color) {
-    this->symbol = (color == White) ? WHITE_QUEEN : BLACK_QUEEN;
-}
-
 // Public Method: isPossibleMove
 // =============================
 // This method takes a ChessSquare and a pointer to the ChessPiece
@@ -84,7 +76,7 @@ pair<bool, bool> Queen::isPossibleMove(ChessSquare& square,
 // Friend Operator: <<
 // ===================
 // Outputs the symbol property of the Queen operand.
-ostream& operator<<(ostream& os, Queen queen) { 
-    os << queen.symbol;
+ostream& operator<<(ostream& os, const Queen& queen) {
+    os << queen.getSymbol();
     return os;
 }
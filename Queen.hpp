@@ -18,14 +18,6 @@ using namespace std;
 // is a subclass of ChessPiece. This class defines how a Queen can move,
 // its name and the symbol it is given according to its Color.
 class Queen : public ChessPiece {
-    
-    private:
-
-        // Method: initSymbol
-        // ==================
-        // This method initialises the symbol
-        // property of the Queen given its Color.
-        void initSymbol(Color color);
 
     public:
 
@@ -56,7 +48,7 @@ class Queen : public ChessPiece {
         // Operator: <<
         // ============
         // Outputs the symbol property of the Queen operand.
-        friend ostream& operator<<(ostream& os, Queen queen);
+        friend ostream& operator<<(ostream& os, const Queen& queen);
 };
 
 #endif
@@ -12,14 +12,15 @@ using namespace std;
 
 // Constructor: Default
 // ====================
-Rook::Rook() : ChessPiece() {}
+Rook::Rook() : ChessPiece() {
+    this->type = RookType;
+}
 
 // Constructor:
 // ============
 // This constructor takes a Color and creates a Rook of that Color.
 Rook::Rook(Color color) : ChessPiece(color) {
-    this->name = ROOK_NAME;
-    this->initSymbol(color);
+    this->type = RookType;
 }
 
 // Constructor:
@@ -28,22 +29,13 @@ Rook::Rook(Color color) : ChessPiece(color) {
 // constructs a Rook of that Color, setting its square
 // property to point to the given ChessSquare.
 Rook::Rook(Color c, const ChessSquare& cs) : ChessPiece(c, cs) {
-    this->name = ROOK_NAME;
-    this->initSymbol(c);
+    this->type = RookType;
 }
 
 // Destructor:
 // ===========
 Rook::~Rook() {}
 
-// Private Method: initSymbol
-// ==========================
-// This method initialises the symbol
-// property of the Rook given its Color.
-void Rook::initSymbol(Color color) {
-    this->symbol = (color == White) ? WHITE_ROOK : BLACK_ROOK;
-}
-
 // Public Method: isPossibleMove
 // =============================
 // This method takes a ChessSquare and a pointer to the ChessPiece
@@ -81,7 +73,7 @@ pair<bool, bool> Rook::isPossibleMove(ChessSquare& square,
 // Friend Operator: <<
 // ===================
 // Outputs the symbol property of the Rook operand.
-ostream& operator<<(ostream& os, Rook rook) {
-    os << rook.symbol;
+ostream& operator<<(ostream& os, const Rook& rook) {
+    os << rook.getSymbol();
     return os;
 }
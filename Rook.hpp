@@ -19,14 +19,6 @@ using namespace std;
 // its name and the symbol it is given according to its Color.
 class Rook : public ChessPiece {
 
-    private:
-
-        // Method: initSymbol
-        // ==================
-        // This method initialises the symbol
-        // property of the Rook given its Color.
-        void initSymbol(Color color);
-
     public:
 
         // Constructor:
@@ -56,7 +48,7 @@ class Rook : public ChessPiece {
         // Operator: <<
         // ============
         // Outputs the symbol property of the Rook operand.
-        friend ostream& operator<<(ostream& os, Rook rook);
+        friend ostream& operator<<(ostream& os, const Rook& rook);
 };
 
 #endif
@@ -0,0 +1,564 @@
+// ==========================================
+// File:    Search.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+using namespace std;
+
+#include "Search.hpp"
+#include "MoveGenerator.hpp"
+#include "MovePicker.hpp"
+#include "Settings.hpp"
+
+// Constants: Move Ordering
+// ========================
+// Captures are offset so that they are always tried before quiet moves.
+// History scores are halved whenever one of them reaches HISTORY_LIMIT,
+// so that recent cut-offs weigh more than old ones.
+const int CAPTURE_SCORE = 1 << 20;
+const int HISTORY_LIMIT = 1 << 16;
+
+// Lookup Table: LMR_REDUCTIONS
+// ============================
+// The number of plies by which a late move is reduced, given the depth
+// and how many moves were searched before it. Reductions grow with the
+// logarithm of both, as is common practice.
+static int LMR_REDUCTIONS[MAX_PLY][MAX_MOVES];
+
+// Struct: ReductionsInitialiser
+// =============================
+// A single static instance of this struct fills
+// in LMR_REDUCTIONS before main is entered.
+static struct ReductionsInitialiser {
+    ReductionsInitialiser() {
+        for (int depth = 0; depth < MAX_PLY; ++depth) {
+            for (int moves = 0; moves < MAX_MOVES; ++moves) {
+                LMR_REDUCTIONS[depth][moves] = (depth == 0 || moves == 0)
+                    ? 0
+                    : static_cast<int>(0.75 + log(depth) * log(moves) / 2.25);
+            }
+        }
+    }
+} reductionsInitialiser;
+
+// Function: pickNext
+// ==================
+// Swaps the highest scoring move from index onwards into index. As most
+// nodes are cut off after trying a few moves, picking moves one at a
+// time is cheaper than sorting all of them up front.
+static void pickNext(Move* moves, int* scores, int count, int index) {
+    int best = index;
+    for (int i = index + 1; i < count; ++i) {
+        if (scores[i] > scores[best]) best = i;
+    }
+    swap(moves[index], moves[best]);
+    swap(scores[index], scores[best]);
+}
+
+// Constructor:
+// ============
+// Takes the Position to search, which is copied.
+Search::Search(const Position& position)
+    : position(position), completedDepth(0), isStopped(false),
+      stopSignal(nullptr), isPonderHit(false), nodes(0),
+      quiescenceNodes(0) {}
+
+// Public Method: setNetwork
+// ==========================
+// Takes a loaded Network for the Evaluation to use, or a nullptr
+// to use the material and piece-square evaluation.
+void Search::setNetwork(const Network* network) {
+    this->evaluation.setNetwork(network);
+}
+
+// Public Method: setStopSignal
+// =============================
+// Takes a flag that another thread may set to stop the search.
+void Search::setStopSignal(const atomic<bool>* stopSignal) {
+    this->stopSignal = stopSignal;
+}
+
+// Public Method: setInfoCallback
+// ===============================
+// Takes a function to call at the end of each completed iteration.
+void Search::setInfoCallback(function<void(const SearchInfo&)> callback) {
+    this->infoCallback = callback;
+}
+
+// Public Method: ponderHit
+// ========================
+// Tells a ponder search that the opponent played the expected move.
+// The search thread picks this up the next time it checks its limits.
+void Search::ponderHit() {
+    this->isPonderHit = true;
+}
+
+// Public Method: setOptions
+// ==========================
+// Sets the selective search techniques to use.
+void Search::setOptions(const SearchOptions& options) {
+    this->options = options;
+}
+
+// Public Method: getOptions
+// ==========================
+// Returns the selective search techniques in use.
+const SearchOptions& Search::getOptions() const {
+    return this->options;
+}
+
+// Public Method: search
+// =====================
+// Searches the Position one ply deeper at a time until one of the given
+// limits is reached and returns its score, as found by the last
+// completed iteration, from the point of view of the side to move.
+// Each iteration tries the best move of the previous one first and
+// reuses its killers and history, which more than pays for the
+// shallower iterations. The best move found is kept for getBestMove.
+int Search::search(const SearchLimits& limits) {
+    this->limits = limits;
+    this->timeManager.init(limits, this->position.getSideToMove());
+    this->bestMove = Move();
+    this->principalVariation.clear();
+    this->completedDepth = 0;
+    this->isStopped = false;
+    this->nodes = 0;
+    this->quiescenceNodes = 0;
+    this->evaluation.reset();
+    memset(this->killers, 0, sizeof(this->killers));
+    memset(this->history, 0, sizeof(this->history));
+
+    int maxDepth = (limits.depth > 0) ? min(limits.depth, MAX_PLY - 1)
+                                      : MAX_PLY - 1;
+    int score = 0;
+    for (int depth = 1; depth <= maxDepth; ++depth) {
+        this->iterationBestMove = Move();
+        int iterationScore = this->searchRoot(depth, score);
+        if (this->isStopped) break;
+
+        bool hasBestMoveChanged = this->iterationBestMove != this->bestMove;
+        score = iterationScore;
+        this->bestMove = this->iterationBestMove;
+        this->principalVariation.assign(this->pvTable[0],
+                                        this->pvTable[0] + this->pvLength[0]);
+        this->completedDepth = depth;
+        if (this->infoCallback) {
+            SearchInfo info;
+            info.depth = depth;
+            info.score = score;
+            info.nodes = this->nodes;
+            info.time = this->timeManager.getElapsed();
+            info.principalVariation = this->principalVariation;
+            this->infoCallback(info);
+        }
+
+        // A forced mate will not get any better by searching deeper.
+        if (this->bestMove.isNull() || abs(score) >= MATE_BOUND) break;
+        this->checkPonderHit();
+        this->timeManager.update(hasBestMoveChanged);
+        if (this->timeManager.isSoftDeadlinePassed()) break;
+        if (limits.nodes > 0 && this->nodes >= limits.nodes) break;
+        if (this->stopSignal != nullptr && *this->stopSignal) break;
+    }
+    return score;
+}
+
+// Public Method: search
+// =====================
+// Searches the Position one ply deeper at a time up to the given
+// depth, which must be at least 1, with no other limit.
+int Search::search(int depth) {
+    SearchLimits limits;
+    limits.depth = max(depth, 1);
+    return this->search(limits);
+}
+
+// Private Method: checkLimits
+// ===========================
+// Stops the search if its node limit or hard deadline is reached. The
+// first iteration is always completed, so that there is a best move to
+// return, but it only takes a handful of nodes.
+void Search::checkLimits() {
+    this->checkPonderHit();
+    if (this->completedDepth == 0) return;
+    if ((this->stopSignal != nullptr && *this->stopSignal) ||
+        (this->limits.nodes > 0 && this->nodes >= this->limits.nodes) ||
+        this->timeManager.isHardDeadlinePassed()) {
+        this->isStopped = true;
+    }
+}
+
+// Private Method: checkPonderHit
+// ==============================
+// Starts the clock of a ponder search once it gets a ponder hit, at
+// which point the time of the opponent's move starts to count.
+void Search::checkPonderHit() {
+    if (this->limits.isPonder && this->isPonderHit.exchange(false)) {
+        this->limits.isPonder = false;
+        this->timeManager.init(this->limits,
+                               this->position.getSideToMove());
+    }
+}
+
+// Private Method: updatePv
+// ========================
+// Takes a Move that raised alpha at the given ply and makes it,
+// followed by the best line from the next ply, the best line.
+void Search::updatePv(Move move, int ply) {
+    Move* line = this->pvTable[ply];
+    const Move* next = this->pvTable[ply + 1];
+    line[0] = move;
+    copy(next, next + this->pvLength[ply + 1], line + 1);
+    this->pvLength[ply] = this->pvLength[ply + 1] + 1;
+}
+
+// Private Method: searchRoot
+// ==========================
+// Searches the Position to the given depth, starting with a window of
+// ASPIRATION_WINDOW on either side of the score of the previous
+// iteration. Whenever the score falls outside of the window, the
+// window is widened on that side, twice as much each time, and the
+// Position is searched again.
+int Search::searchRoot(int depth, int previousScore) {
+    int alpha = -INFINITE_SCORE;
+    int beta = INFINITE_SCORE;
+    int delta = ASPIRATION_WINDOW;
+    if (this->options.useAspiration && depth >= ASPIRATION_MIN_DEPTH &&
+        abs(previousScore) < MATE_BOUND) {
+        alpha = previousScore - delta;
+        beta = previousScore + delta;
+    }
+
+    while (true) {
+        int score = this->alphaBeta(depth, alpha, beta, 0, false);
+        if (this->isStopped) return 0;
+        if (score <= alpha) {
+            alpha = max(score - delta, -INFINITE_SCORE);
+        } else if (score >= beta) {
+            beta = min(score + delta, static_cast<int>(INFINITE_SCORE));
+        } else {
+            return score;
+        }
+        delta *= 2;
+    }
+}
+
+// Private Method: makeMove
+// ========================
+// Plays a Move on the Position and lets the Evaluation know.
+void Search::makeMove(Move move, UndoInfo& undo) {
+    this->position.makeMove(move, undo);
+    this->evaluation.pushMove(this->position, move, undo);
+}
+
+// Private Method: unmakeMove
+// ==========================
+// Takes back a Move on the Position and lets the Evaluation know.
+void Search::unmakeMove(Move move, const UndoInfo& undo) {
+    this->position.unmakeMove(move, undo);
+    this->evaluation.popMove();
+}
+
+// Private Method: alphaBeta
+// =========================
+// Searches the current Position to the given depth within the window
+// (alpha, beta) and returns its score from the point of view of the
+// side to move. Ply is the distance from the root. Nodes searched with
+// a window wider than a null window are on the principal variation and
+// are never pruned, as their exact score is needed.
+int Search::alphaBeta(int depth, int alpha, int beta, int ply,
+                      bool isNullAllowed) {
+
+    // Leaves are resolved by the quiescence search.
+    if (depth <= 0) return this->quiescence(alpha, beta, ply);
+
+    this->pvLength[ply] = 0;
+    if ((++this->nodes & (POLL_INTERVAL - 1)) == 0) this->checkLimits();
+    if (this->isStopped) return 0;
+    if (ply >= MAX_PLY) return this->evaluation.evaluate(this->position);
+
+    Color us = this->position.getSideToMove();
+    bool isInCheck = this->position.isInCheck(us);
+    bool isPvNode = beta - alpha > 1;
+    int staticEval = 0;
+    if (!isInCheck && !isPvNode) {
+        staticEval = this->evaluation.evaluate(this->position);
+    }
+
+    // If the side to move is still doing well after passing the turn,
+    // a real move will almost surely do better, so the node is cut off
+    // after a reduced search. This fails when any move would make
+    // things worse (zugzwang), which is mostly the case in endings
+    // with nothing but Pawns, so those are left alone.
+    if (this->options.useNullMove && isNullAllowed && !isPvNode &&
+        !isInCheck && depth >= NULL_MOVE_MIN_DEPTH && staticEval >= beta &&
+        this->position.hasNonPawnMaterial(us)) {
+        int reduction = NULL_MOVE_REDUCTION + depth / NULL_MOVE_DEPTH_STEP;
+        this->position.makeNullMove();
+        int score = -this->alphaBeta(depth - 1 - reduction, -beta,
+                                     -beta + 1, ply + 1, false);
+        this->position.unmakeNullMove();
+        if (this->isStopped) return 0;
+
+        // Mates found after a null move are not to be trusted.
+        if (score >= beta) return (score >= MATE_BOUND) ? beta : score;
+    }
+
+    // Near the leaves, quiet moves cannot make up for a static
+    // evaluation that is too far below alpha.
+    int futilityScore = -INFINITE_SCORE;
+    if (this->options.useFutility && !isPvNode && !isInCheck &&
+        depth <= FUTILITY_MAX_DEPTH &&
+        staticEval + FUTILITY_MARGINS[depth] <= alpha) {
+        futilityScore = staticEval + FUTILITY_MARGINS[depth];
+    }
+
+    Move priorityMove = (ply == 0) ? this->bestMove : Move();
+    MovePicker picker(this->position, priorityMove, this->killers[ply],
+                      this->history[us]);
+
+    int bestScore = -INFINITE_SCORE;
+    int legalMoves = 0;
+    Move move;
+    while (!(move = picker.next()).isNull()) {
+        if (!this->position.isLegal(move)) continue;
+        ++legalMoves;
+        MoveStage stage = picker.getStage();
+        bool isQuiet = this->position.pieceOn(move.getTo()) == NO_PIECE;
+
+        UndoInfo undo;
+        this->makeMove(move, undo);
+        bool givesCheck =
+            this->position.isInCheck(this->position.getSideToMove());
+
+        if (futilityScore > -INFINITE_SCORE && isQuiet && !givesCheck) {
+            this->unmakeMove(move, undo);
+            bestScore = max(bestScore, futilityScore);
+            continue;
+        }
+
+        // Quiet moves and losing captures late in the list are
+        // unlikely to be best, so they are first searched to a
+        // reduced depth, and only searched again if they beat alpha.
+        int newDepth = depth - 1;
+        int reduction = 0;
+        if (this->options.useLmr && depth >= LMR_MIN_DEPTH &&
+            legalMoves > LMR_MIN_MOVES && !isInCheck && !givesCheck &&
+            (stage == QuietsStage || stage == BadCapturesStage)) {
+            reduction = LMR_REDUCTIONS[min(depth, MAX_PLY - 1)]
+                                      [min(legalMoves, MAX_MOVES - 1)];
+            if (isPvNode) --reduction;
+            reduction = max(0, min(reduction, newDepth - 1));
+        }
+
+        // The first move is searched with the full window. With
+        // principal variation search, the others are only checked
+        // against a null window to prove that they are no better,
+        // and searched again with the full window if they are.
+        int score;
+        if (legalMoves == 1) {
+            score = -this->alphaBeta(newDepth, -beta, -alpha, ply + 1, true);
+        } else if (this->options.usePvs) {
+            score = -this->alphaBeta(newDepth - reduction, -alpha - 1,
+                                     -alpha, ply + 1, true);
+            if (reduction > 0 && score > alpha) {
+                score = -this->alphaBeta(newDepth, -alpha - 1, -alpha,
+                                         ply + 1, true);
+            }
+            if (score > alpha && score < beta) {
+                score = -this->alphaBeta(newDepth, -beta, -alpha,
+                                         ply + 1, true);
+            }
+        } else {
+            score = -this->alphaBeta(newDepth - reduction, -beta, -alpha,
+                                     ply + 1, true);
+            if (reduction > 0 && score > alpha) {
+                score = -this->alphaBeta(newDepth, -beta, -alpha,
+                                         ply + 1, true);
+            }
+        }
+        this->unmakeMove(move, undo);
+        if (this->isStopped) return 0;
+
+        if (score > bestScore) {
+            bestScore = score;
+            if (ply == 0) this->iterationBestMove = move;
+            if (score > alpha) {
+                alpha = score;
+                if (isPvNode) this->updatePv(move, ply);
+                if (alpha >= beta) {
+                    if (isQuiet) this->updateQuietStats(move, depth, ply);
+                    break;
+                }
+            }
+        }
+    }
+
+    // With no legal move the game is over: checkmate scores
+    // as a loss, the sooner the worse, and stalemate as a draw.
+    if (legalMoves == 0) return isInCheck ? -MATE_SCORE + ply : 0;
+    return bestScore;
+}
+
+// Private Method: quiescence
+// ==========================
+// Searches captures only until the Position is quiet and returns its
+// score from the point of view of the side to move. The side to move
+// may stand pat on the static evaluation rather than capture. Captures
+// that cannot lift the score up to alpha even if they win their victim
+// outright are pruned (delta pruning), as are captures that lose
+// material according to the static exchange evaluation. When in check
+// standing pat is not an option, so every evasion is searched instead.
+int Search::quiescence(int alpha, int beta, int ply) {
+    this->pvLength[ply] = 0;
+    ++this->quiescenceNodes;
+    if ((++this->nodes & (POLL_INTERVAL - 1)) == 0) this->checkLimits();
+    if (this->isStopped) return 0;
+    if (ply >= MAX_PLY) return this->evaluation.evaluate(this->position);
+
+    MoveList moves;
+    int scores[MAX_MOVES];
+    MoveGenerator generator(this->position);
+    Color us = this->position.getSideToMove();
+    bool isInCheck = this->position.isInCheck(us);
+
+    int bestScore;
+    int standPat = 0;
+    if (isInCheck) {
+        bestScore = -INFINITE_SCORE;
+        generator.generateEvasions(moves);
+    } else {
+        standPat = this->evaluation.evaluate(this->position);
+        if (standPat >= beta) return standPat;
+
+        // If even winning a Queen cannot bring the score
+        // up to alpha, no capture will, so give up here.
+        if (standPat + PIECE_VALUES[QueenType] + DELTA_MARGIN <= alpha) {
+            return standPat;
+        }
+        if (standPat > alpha) alpha = standPat;
+        bestScore = standPat;
+        generator.generateCaptures(moves);
+    }
+    int count = moves.size();
+    this->scoreMoves(moves.begin(), scores, count);
+
+    int legalMoves = 0;
+    for (int i = 0; i < count; ++i) {
+        pickNext(moves.begin(), scores, count, i);
+        Move move = moves[i];
+
+        if (!isInCheck) {
+            int victim = PIECE_VALUES[typeOf(this->position.pieceOn(
+                                                        move.getTo()))];
+            if (standPat + victim + DELTA_MARGIN <= alpha) continue;
+            if (this->position.see(move) < 0) continue;
+        }
+        if (!this->position.isLegal(move)) continue;
+        ++legalMoves;
+
+        UndoInfo undo;
+        this->makeMove(move, undo);
+        int score = -this->quiescence(-beta, -alpha, ply + 1);
+        this->unmakeMove(move, undo);
+        if (this->isStopped) return 0;
+
+        if (score > bestScore) {
+            bestScore = score;
+            if (score > alpha) {
+                alpha = score;
+                if (alpha >= beta) break;
+            }
+        }
+    }
+
+    // In check with no legal evasion is checkmate.
+    if (isInCheck && legalMoves == 0) return -MATE_SCORE + ply;
+    return bestScore;
+}
+
+// Private Method: scoreMoves
+// ==========================
+// Gives each move a score used to order the search: captures are scored
+// most valuable victim first, then least valuable attacker first, and
+// are all tried before the quiet moves.
+void Search::scoreMoves(const Move* moves, int* scores, int count) const {
+    for (int i = 0; i < count; ++i) {
+        Piece victim = this->position.pieceOn(moves[i].getTo());
+        if (victim == NO_PIECE) {
+            scores[i] = 0;
+        } else {
+            Piece attacker = this->position.pieceOn(moves[i].getFrom());
+            scores[i] = CAPTURE_SCORE + 8 * typeOf(victim) - typeOf(attacker);
+        }
+    }
+}
+
+// Private Method: updateQuietStats
+// ================================
+// Takes a quiet Move that caused a cut-off at the given depth and ply,
+// makes it the first killer of the ply and raises its history score by
+// the square of the depth, as cut-offs far from the leaves save more.
+void Search::updateQuietStats(Move move, int depth, int ply) {
+    if (this->killers[ply][0] != move) {
+        this->killers[ply][1] = this->killers[ply][0];
+        this->killers[ply][0] = move;
+    }
+
+    Color us = this->position.getSideToMove();
+    int (*history)[NUM_SQUARES] = this->history[us];
+    int& score = history[move.getFrom()][move.getTo()];
+    score += depth * depth;
+    if (score >= HISTORY_LIMIT) {
+        for (int from = 0; from < NUM_SQUARES; ++from) {
+            for (int to = 0; to < NUM_SQUARES; ++to) history[from][to] /= 2;
+        }
+    }
+}
+
+// Public Method: getBestMove
+// ==========================
+// Returns the best move found by the last call to search.
+Move Search::getBestMove() const {
+    return this->bestMove;
+}
+
+// Public Method: getPrincipalVariation
+// =====================================
+// Returns the best line found by the last completed iteration.
+const vector<Move>& Search::getPrincipalVariation() const {
+    return this->principalVariation;
+}
+
+// Public Method: getCompletedDepth
+// ================================
+// Returns the depth of the last iteration completed
+// by the last call to search.
+int Search::getCompletedDepth() const {
+    return this->completedDepth;
+}
+
+// Public Method: getNodes
+// =======================
+// Returns the number of nodes visited by the last search.
+unsigned long long Search::getNodes() const {
+    return this->nodes;
+}
+
+// Public Method: getQuiescenceNodes
+// =================================
+// Returns how many of those nodes were quiescence nodes.
+unsigned long long Search::getQuiescenceNodes() const {
+    return this->quiescenceNodes;
+}
+
+// Public Method: getEvaluation
+// ============================
+// Returns the Evaluation used by the Search.
+const Evaluation& Search::getEvaluation() const {
+    return this->evaluation;
+}
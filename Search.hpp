@@ -0,0 +1,261 @@
+// ==========================================
+// File:    Search.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef SEARCH_HPP
+#define SEARCH_HPP
+
+#include <atomic>
+#include <functional>
+#include <vector>
+using namespace std;
+
+#include "Position.hpp"
+#include "Evaluation.hpp"
+#include "Network.hpp"
+#include "Move.hpp"
+#include "TimeManager.hpp"
+
+// Struct: SearchOptions
+// =====================
+// Turns each of the selective search techniques used by the Search on
+// or off, so that their effect on node counts and time to depth can be
+// measured one at a time. All of them are on by default.
+struct SearchOptions {
+    bool usePvs;            // Principal variation search.
+    bool useAspiration;     // Aspiration windows at the root.
+    bool useNullMove;       // Null-move pruning.
+    bool useLmr;            // Late-move reductions.
+    bool useFutility;       // Futility pruning near the leaves.
+
+    SearchOptions()
+        : usePvs(true), useAspiration(true), useNullMove(true),
+          useLmr(true), useFutility(true) {}
+};
+
+// Struct: SearchInfo
+// ===================
+// Describes the result of an iteration of the search, as reported to
+// the callback set with Search::setInfoCallback. The score is from the
+// point of view of the side to move and the time is in milliseconds.
+struct SearchInfo {
+    int depth;                      // Depth of the iteration.
+    int score;                      // Score of the Position.
+    unsigned long long nodes;       // Nodes visited so far.
+    int64_t time;                   // Time elapsed so far.
+    vector<Move> principalVariation; // Best line found.
+};
+
+// Class: Search
+// =============
+// This class defines the search used to find the best move in a
+// Position. It runs an iterative deepening alpha-beta search on its own
+// copy of the Position and extends every leaf with a quiescence search,
+// which keeps playing captures until the position is quiet so that
+// leaves in the middle of an exchange are not misjudged. Moves are
+// handed out by a MovePicker, helped by killer moves and a history
+// table, so that most cut-offs are found by the first move tried. This
+// lets the search spend less effort on the moves after it: they are
+// searched with a null window (principal variation search) and, late in
+// the list, to a reduced depth (late-move reductions). Nodes where
+// passing the turn already fails high are cut off (null-move pruning),
+// quiet moves that cannot raise the score near the leaves are skipped
+// (futility pruning), and each iteration starts with a narrow window
+// around the score of the previous one (aspiration windows).
+//
+// A search runs within SearchLimits. Between iterations, and every
+// POLL_INTERVAL nodes during them, the Search checks those limits with
+// its TimeManager, and when they are reached it abandons the current
+// iteration and keeps the best move of the last completed one. It can
+// also be stopped from another thread through a stop signal.
+class Search {
+
+    private:
+
+        Position position;          // Position being searched.
+        Evaluation evaluation;      // Static evaluation at the leaves.
+        SearchOptions options;      // Techniques in use.
+        SearchLimits limits;        // Limits of the current search.
+        TimeManager timeManager;    // Deadlines of the current search.
+        Move bestMove;              // Best move of the last iteration.
+        Move iterationBestMove;     // Best move of the current one.
+        int completedDepth;         // Depth of the last iteration.
+        bool isStopped;             // Whether the limits were reached.
+        const atomic<bool>* stopSignal; // Set from outside to stop.
+        atomic<bool> isPonderHit;   // Whether a ponder hit is pending.
+        function<void(const SearchInfo&)> infoCallback; // Iteration info.
+        unsigned long long nodes;   // Nodes visited, in total.
+        unsigned long long quiescenceNodes; // Of which in quiescence.
+
+        // Quiet moves that caused a cut-off, two per ply, and how often
+        // each quiet move of each Color did, by source and destination.
+        Move killers[MAX_PLY + 1][2];
+        int history[2][NUM_SQUARES][NUM_SQUARES];
+
+        // The best line found from each ply, and the best line
+        // from the root found by the last completed iteration.
+        Move pvTable[MAX_PLY + 1][MAX_PLY + 1];
+        int pvLength[MAX_PLY + 1];
+        vector<Move> principalVariation;
+
+        // Method: makeMove
+        // ================
+        // Plays a Move on the Position and lets the Evaluation know.
+        void makeMove(Move move, UndoInfo& undo);
+
+        // Method: unmakeMove
+        // ==================
+        // Takes back a Move on the Position and lets the Evaluation know.
+        void unmakeMove(Move move, const UndoInfo& undo);
+
+        // Method: checkLimits
+        // ===================
+        // Stops the search if it is signalled to or if its node limit
+        // or hard deadline is reached. The first iteration is always
+        // completed, so that there is a best move to return.
+        void checkLimits();
+
+        // Method: checkPonderHit
+        // ======================
+        // Starts the clock of a ponder search once it gets a ponder hit.
+        void checkPonderHit();
+
+        // Method: updatePv
+        // ================
+        // Takes a Move that raised alpha at the given ply and makes it,
+        // followed by the best line from the next ply, the best line.
+        void updatePv(Move move, int ply);
+
+        // Method: searchRoot
+        // ==================
+        // Searches the Position to the given depth, starting with an
+        // aspiration window around the score of the previous iteration
+        // and widening it until the score falls inside it.
+        int searchRoot(int depth, int previousScore);
+
+        // Method: alphaBeta
+        // =================
+        // Searches the current Position to the given depth within the
+        // window (alpha, beta) and returns its score from the point of
+        // view of the side to move. Ply is the distance from the root.
+        // A null move is only tried if isNullAllowed is true, so that
+        // two null moves are never played in a row.
+        int alphaBeta(int depth, int alpha, int beta, int ply,
+                      bool isNullAllowed);
+
+        // Method: quiescence
+        // ==================
+        // Searches captures only until the Position is quiet and
+        // returns its score from the point of view of the side to
+        // move. When in check every evasion is searched instead.
+        int quiescence(int alpha, int beta, int ply);
+
+        // Method: scoreMoves
+        // ==================
+        // Gives each move a score used to order the search: captures
+        // are scored most valuable victim first, then least valuable
+        // attacker first, and are all tried before the quiet moves.
+        void scoreMoves(const Move* moves, int* scores, int count) const;
+
+        // Method: updateQuietStats
+        // ========================
+        // Takes a quiet Move that caused a cut-off at the given depth
+        // and ply and records it as a killer and in the history table.
+        void updateQuietStats(Move move, int depth, int ply);
+
+    public:
+
+        // Constructor:
+        // ============
+        // Takes the Position to search, which is copied.
+        Search(const Position& position);
+
+        // Method: setNetwork
+        // ==================
+        // Takes a loaded Network for the Evaluation to use, or a
+        // nullptr to use the material and piece-square evaluation.
+        // The Network is not copied and must outlive the Search.
+        void setNetwork(const Network* network);
+
+        // Method: setStopSignal
+        // =====================
+        // Takes a flag that another thread may set to stop the search,
+        // which then returns as soon as possible, or a nullptr.
+        void setStopSignal(const atomic<bool>* stopSignal);
+
+        // Method: setInfoCallback
+        // =======================
+        // Takes a function to call with a SearchInfo at the end of
+        // each completed iteration. It is called on the thread
+        // running the search.
+        void setInfoCallback(function<void(const SearchInfo&)> callback);
+
+        // Method: ponderHit
+        // =================
+        // Tells a ponder search that the opponent played the expected
+        // move, so that it starts applying its time limits. May be
+        // called from another thread while the search runs.
+        void ponderHit();
+
+        // Method: setOptions
+        // ==================
+        // Sets the selective search techniques to use.
+        void setOptions(const SearchOptions& options);
+
+        // Method: getOptions
+        // ==================
+        // Returns the selective search techniques in use.
+        const SearchOptions& getOptions() const;
+
+        // Method: search
+        // ==============
+        // Searches the Position one ply deeper at a time until one of
+        // the given limits is reached and returns its score, as found
+        // by the last completed iteration, from the point of view of
+        // the side to move. The best move found is kept for getBestMove.
+        int search(const SearchLimits& limits);
+
+        // Method: search
+        // ==============
+        // Searches the Position one ply deeper at a time up to the given
+        // depth, which must be at least 1, with no other limit.
+        int search(int depth);
+
+        // Method: getBestMove
+        // ===================
+        // Returns the best move found by the last call to search. It
+        // is the null Move if the side to move has no legal move.
+        Move getBestMove() const;
+
+        // Method: getPrincipalVariation
+        // =============================
+        // Returns the best line found by the last completed iteration
+        // of the last call to search, starting with the best move.
+        const vector<Move>& getPrincipalVariation() const;
+
+        // Method: getCompletedDepth
+        // =========================
+        // Returns the depth of the last iteration completed
+        // by the last call to search.
+        int getCompletedDepth() const;
+
+        // Method: getNodes
+        // ================
+        // Returns the number of nodes visited by the last search.
+        unsigned long long getNodes() const;
+
+        // Method: getQuiescenceNodes
+        // ==========================
+        // Returns how many of those nodes were quiescence nodes.
+        unsigned long long getQuiescenceNodes() const;
+
+        // Method: getEvaluation
+        // =====================
+        // Returns the Evaluation, e.g. to read the statistics
+        // of its PawnTable.
+        const Evaluation& getEvaluation() const;
+};
+
+#endif
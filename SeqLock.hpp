@@ -0,0 +1,110 @@
+// ==========================================
+// File:    SeqLock.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef SEQ_LOCK_HPP
+#define SEQ_LOCK_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+using namespace std;
+
+#include "Settings.hpp"
+
+// Class: SeqLock
+// ==============
+// This class publishes a trivially copyable value written by a single
+// thread to any number of reader threads, without locks or allocation.
+// The writer bumps a sequence number to an odd value, writes the value
+// and bumps it again to an even one. A reader copies the value between
+// two reads of the sequence number and retries if either was odd or
+// they differ, as the writer was then halfway through. The writer thus
+// never waits for readers, and readers only retry while it writes. The
+// value is kept in atomic words so that a torn copy, which is always
+// thrown away, is not a data race.
+template <typename T>
+class SeqLock {
+
+    static_assert(is_trivially_copyable<T>::value,
+                  "A SeqLock can only hold a trivially copyable value.");
+
+    private:
+
+        static const size_t NUM_WORDS = (sizeof(T) + 7) / 8;
+
+        alignas(CACHE_LINE_SIZE) atomic<uint64_t> sequence;
+        atomic<uint64_t> words[NUM_WORDS];
+
+        // Copying would copy the value of a live SeqLock.
+        SeqLock(const SeqLock& other);
+        SeqLock& operator=(const SeqLock& other);
+
+    public:
+
+        // Constructor: Default
+        // ====================
+        // Publishes a value-initialised value.
+        SeqLock() : sequence(0) {
+            this->store(T());
+        }
+
+        // Constructor:
+        // ============
+        // Publishes the given value.
+        SeqLock(const T& value) : sequence(0) {
+            this->store(value);
+        }
+
+        // Method: store
+        // =============
+        // Publishes a new value. Must only be called from one thread.
+        void store(const T& value) {
+            uint64_t buffer[NUM_WORDS] = {0};
+            memcpy(buffer, &value, sizeof(T));
+
+            uint64_t sequence = this->sequence.load(memory_order_relaxed);
+            this->sequence.store(sequence + 1, memory_order_relaxed);
+            atomic_thread_fence(memory_order_release);
+            for (size_t i = 0; i < NUM_WORDS; ++i) {
+                this->words[i].store(buffer[i], memory_order_relaxed);
+            }
+            this->sequence.store(sequence + 2, memory_order_release);
+        }
+
+        // Method: load
+        // ============
+        // Returns a consistent copy of the value last published.
+        // May be called from any thread.
+        T load() const {
+            uint64_t buffer[NUM_WORDS];
+            uint64_t before;
+            uint64_t after;
+            do {
+                before = this->sequence.load(memory_order_acquire);
+                for (size_t i = 0; i < NUM_WORDS; ++i) {
+                    buffer[i] = this->words[i].load(memory_order_relaxed);
+                }
+                atomic_thread_fence(memory_order_acquire);
+                after = this->sequence.load(memory_order_relaxed);
+            } while ((before & 1) || before != after);
+
+            T value;
+            memcpy(&value, buffer, sizeof(T));
+            return value;
+        }
+
+        // Method: getVersion
+        // ==================
+        // Returns how many values have been published, so that a reader
+        // can tell cheaply whether there is a new one.
+        uint64_t getVersion() const {
+            return this->sequence.load(memory_order_acquire) / 2;
+        }
+};
+
+#endif
@@ -0,0 +1,201 @@
+// ==========================================
+// File:    ServiceCheck.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <cstdint>
+#include <future>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+using namespace std;
+
+#include "MoveService.hpp"
+#include "MoveGenerator.hpp"
+#include "Termination.hpp"
+
+// The service is driven by CHECK_CLIENTS threads at once, each playing
+// CHECK_GAMES_PER_CLIENT games of CHECK_MOVES_PER_GAME moves on a
+// MoveService with CHECK_WORKERS workers.
+const int CHECK_CLIENTS = 4;
+const int CHECK_WORKERS = 4;
+const int CHECK_GAMES_PER_CLIENT = 500;
+const int CHECK_MOVES_PER_GAME = 80;
+
+// Struct: GameScript
+// ==================
+// The moves sent for a game, along with the MoveResult each of them
+// gets when the game is replayed on a single thread.
+struct GameScript {
+    vector<Move> moves;
+    vector<MoveResult> expected;
+};
+
+// Function: nextRandom
+// ====================
+// Takes the state of a linear congruential generator, advances it and
+// returns its next pseudo-random number, so that every run plays the
+// same games.
+static uint32_t nextRandom(uint64_t& state) {
+    state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+    return static_cast<uint32_t>(state >> 33);
+}
+
+// Function: writeScript
+// =====================
+// Takes a seed and writes the script of a game, replaying it move by
+// move with playMove and the draw rules, as a SessionManager does. Most
+// moves are legal ones picked at random, but one in eight goes between
+// two random squares, so that rejected moves and moves sent after the
+// game has ended are replayed too.
+static GameScript writeScript(uint64_t seed) {
+    GameScript script;
+    Position position;
+    position.setStartPosition();
+    int halfmoveClock = 0;
+    bool isGameOver = false;
+    for (int i = 0; i < CHECK_MOVES_PER_GAME; ++i) {
+        MoveList legal;
+        if (!isGameOver) MoveGenerator(position).generateLegal(legal);
+        Move move;
+        if (legal.isEmpty() || nextRandom(seed) % 8 == 0) {
+            move = Move(nextRandom(seed) % NUM_SQUARES,
+                        nextRandom(seed) % NUM_SQUARES);
+        } else {
+            move = legal[nextRandom(seed) % legal.size()];
+        }
+
+        MoveResult result;
+        if (!isGameOver) {
+            result = playMove(position, move);
+            if (result.isPlayed()) {
+                applyDrawRules(position, halfmoveClock, result);
+            }
+            isGameOver = result.isGameOver();
+        }
+        script.moves.push_back(move);
+        script.expected.push_back(result);
+    }
+    return script;
+}
+
+// Function: isSameResult
+// ======================
+// Returns true if both MoveResult objects describe the same outcome.
+static bool isSameResult(const MoveResult& first, const MoveResult& second) {
+    return first.status == second.status && first.color == second.color &&
+           first.moved == second.moved &&
+           first.captured == second.captured && first.from == second.from &&
+           first.to == second.to && first.isCheck == second.isCheck &&
+           first.isCheckmate == second.isCheckmate &&
+           first.isStalemate == second.isStalemate &&
+           first.termination == second.termination;
+}
+
+// Function: runClient
+// ===================
+// Runs on the thread of a client. Creates its games on the service and
+// sends every move of their scripts without waiting for any answer,
+// then compares each answer with the replay. Once its games are ended,
+// a move sent to each of them must find no game. The GameIds of its
+// games are kept in gameIds, and failures counts the wrong answers.
+static void runClient(MoveService& service, const GameScript* scripts,
+                      vector<GameId>& gameIds, int& failures) {
+    vector<future<GameId>> created;
+    for (int i = 0; i < CHECK_GAMES_PER_CLIENT; ++i) {
+        created.push_back(service.createGame());
+    }
+    for (int i = 0; i < CHECK_GAMES_PER_CLIENT; ++i) {
+        gameIds.push_back(created[i].get());
+        if (gameIds[i] == NO_GAME) ++failures;
+    }
+
+    // Send the moves round by round, so that the games of every worker
+    // are interleaved in its queue.
+    vector<future<MoveResult>> results;
+    for (int k = 0; k < CHECK_MOVES_PER_GAME; ++k) {
+        for (int i = 0; i < CHECK_GAMES_PER_CLIENT; ++i) {
+            results.push_back(service.submitMove(gameIds[i],
+                                                 scripts[i].moves[k]));
+        }
+    }
+    for (int k = 0; k < CHECK_MOVES_PER_GAME; ++k) {
+        for (int i = 0; i < CHECK_GAMES_PER_CLIENT; ++i) {
+            MoveResult result =
+                results[k * CHECK_GAMES_PER_CLIENT + i].get();
+            if (!isSameResult(result, scripts[i].expected[k])) ++failures;
+        }
+    }
+
+    results.clear();
+    for (int i = 0; i < CHECK_GAMES_PER_CLIENT; ++i) {
+        service.endGame(gameIds[i]);
+        results.push_back(service.submitMove(gameIds[i],
+                                             scripts[i].moves[0]));
+    }
+    for (int i = 0; i < CHECK_GAMES_PER_CLIENT; ++i) {
+        if (results[i].get().status != NoGameStatus) ++failures;
+    }
+}
+
+int main() {
+    int failed = 0;
+
+    // Replay every game on this thread first.
+    vector<GameScript> scripts;
+    for (int i = 0; i < CHECK_CLIENTS * CHECK_GAMES_PER_CLIENT; ++i) {
+        scripts.push_back(writeScript(i + 1));
+    }
+
+    // Then drive them through the service from every client at once.
+    vector<vector<GameId>> gameIds(CHECK_CLIENTS);
+    vector<int> failures(CHECK_CLIENTS, 0);
+    {
+        MoveService service(CHECK_WORKERS, CHECK_GAMES_PER_CLIENT *
+                                           CHECK_CLIENTS);
+        vector<thread> clients;
+        for (int c = 0; c < CHECK_CLIENTS; ++c) {
+            clients.emplace_back(runClient, ref(service),
+                                 &scripts[c * CHECK_GAMES_PER_CLIENT],
+                                 ref(gameIds[c]), ref(failures[c]));
+        }
+        for (thread& client : clients) client.join();
+    }
+    int wrong = 0;
+    for (int c = 0; c < CHECK_CLIENTS; ++c) wrong += failures[c];
+    if (wrong > 0) ++failed;
+    cout << (wrong == 0 ? "ok     " : "FAILED ") << "service replay of "
+         << CHECK_CLIENTS * CHECK_GAMES_PER_CLIENT << " games, " << wrong
+         << " wrong answers" << endl;
+
+    // No two games may have been given the same GameId.
+    set<GameId> distinct;
+    for (int c = 0; c < CHECK_CLIENTS; ++c) {
+        distinct.insert(gameIds[c].begin(), gameIds[c].end());
+    }
+    bool isDistinct = distinct.size() == static_cast<size_t>(
+                          CHECK_CLIENTS * CHECK_GAMES_PER_CLIENT);
+    if (!isDistinct) ++failed;
+    cout << (isDistinct ? "ok     " : "FAILED ") << "distinct GameIds"
+         << endl;
+
+    // A service without workers cannot be built.
+    bool isRejected = false;
+    try {
+        MoveService service(0, 1);
+    } catch (invalid_argument& e) {
+        isRejected = true;
+    }
+    if (!isRejected) ++failed;
+    cout << (isRejected ? "ok     " : "FAILED ") << "no workers rejected"
+         << endl;
+
+    if (failed > 0) {
+        cout << failed << " check(s) failed" << endl;
+        return 1;
+    }
+    return 0;
+}
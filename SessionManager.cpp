@@ -0,0 +1,139 @@
+// ==========================================
+// File:    SessionManager.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+using namespace std;
+
+#include "SessionManager.hpp"
+
+static_assert(sizeof(GameSlot) < 200, "A GameSlot must stay compact.");
+
+// Constructor:
+// ============
+// Takes the number of games that can be hosted at once and allocates
+// a slot for each of them. The free slots are stacked so that the
+// first games take the first slots.
+SessionManager::SessionManager(size_t capacity)
+    : slots(capacity), freeSlots(capacity) {
+    for (size_t i = 0; i < capacity; ++i) {
+        this->slots[i].generation = 0;
+        this->slots[i].isActive = false;
+        this->slots[i].isGameOver = false;
+        this->freeSlots[i] = static_cast<uint32_t>(capacity - 1 - i);
+    }
+}
+
+// Private Method: findSlot
+// ========================
+// Takes a GameId and returns the slot of that game, or a nullptr if
+// the slot is out of range or now hosts another game, or none.
+GameSlot* SessionManager::findSlot(GameId gameId) {
+    uint32_t index = static_cast<uint32_t>(gameId);
+    uint32_t generation = static_cast<uint32_t>(gameId >> 32);
+    if (index >= this->slots.size()) return nullptr;
+    GameSlot& slot = this->slots[index];
+    if (!slot.isActive || slot.generation != generation) return nullptr;
+    return &slot;
+}
+
+// Private Method: findSlot
+// ========================
+// The const counterpart of the method above.
+const GameSlot* SessionManager::findSlot(GameId gameId) const {
+    return const_cast<SessionManager*>(this)->findSlot(gameId);
+}
+
+// Public Method: createGame
+// =========================
+// Starts a new game from the initial position.
+GameId SessionManager::createGame() {
+    Position position;
+    position.setStartPosition();
+    return this->createGame(position);
+}
+
+// Public Method: createGame
+// =========================
+// Starts a new game from the given Position in the free slot on top of
+// the stack and returns its GameId, or NO_GAME if there is none. The
+// generation of the slot is bumped first, so no GameId is ever NO_GAME.
+GameId SessionManager::createGame(const Position& position) {
+    if (this->freeSlots.empty()) return NO_GAME;
+    uint32_t index = this->freeSlots.back();
+    this->freeSlots.pop_back();
+
+    GameSlot& slot = this->slots[index];
+    slot.position = position;
+    ++slot.generation;
+    slot.isActive = true;
+    slot.isGameOver = !hasLegalMove(position);
+    slot.halfmoveClock = 0;
+    return (static_cast<GameId>(slot.generation) << 32) | index;
+}
+
+// Public Method: endGame
+// ======================
+// Ends the game with the given GameId and pushes its slot back onto
+// the stack of free slots. Returns false if there is no such game.
+bool SessionManager::endGame(GameId gameId) {
+    GameSlot* slot = this->findSlot(gameId);
+    if (slot == nullptr) return false;
+    slot->isActive = false;
+    this->freeSlots.push_back(static_cast<uint32_t>(gameId));
+    return true;
+}
+
+// Public Method: submitMove
+// =========================
+// Takes a GameId and a Move and plays the Move in that game if it is
+// valid, exactly as ChessBoard::submitMove would.
+MoveResult SessionManager::submitMove(GameId gameId, Move move) {
+    MoveResult result;
+    GameSlot* slot = this->findSlot(gameId);
+    if (slot == nullptr) {
+        result.status = NoGameStatus;
+        return result;
+    }
+    if (slot->isGameOver) return result;
+
+    result = playMove(slot->position, move);
+    if (result.isPlayed()) {
+        applyDrawRules(slot->position, slot->halfmoveClock, result);
+    }
+    slot->isGameOver = result.isGameOver();
+    return result;
+}
+
+// Public Method: getPosition
+// ==========================
+// Returns the current Position of the game with the given GameId,
+// or a nullptr if there is no such game.
+const Position* SessionManager::getPosition(GameId gameId) const {
+    const GameSlot* slot = this->findSlot(gameId);
+    return (slot == nullptr) ? nullptr : &slot->position;
+}
+
+// Public Method: isGameOver
+// =========================
+// Returns true if the game with the given GameId has ended,
+// or if there is no such game.
+bool SessionManager::isGameOver(GameId gameId) const {
+    const GameSlot* slot = this->findSlot(gameId);
+    return slot == nullptr || slot->isGameOver;
+}
+
+// Public Method: getSize
+// ======================
+// Returns the number of games being hosted.
+size_t SessionManager::getSize() const {
+    return this->slots.size() - this->freeSlots.size();
+}
+
+// Public Method: getCapacity
+// ==========================
+// Returns the number of games that can be hosted at once.
+size_t SessionManager::getCapacity() const {
+    return this->slots.size();
+}
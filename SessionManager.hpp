@@ -0,0 +1,130 @@
+// ==========================================
+// File:    SessionManager.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef SESSION_MANAGER_HPP
+#define SESSION_MANAGER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+using namespace std;
+
+#include "Position.hpp"
+#include "Move.hpp"
+#include "MoveResult.hpp"
+
+// Type: GameId
+// ============
+// A GameId identifies a game hosted by a SessionManager. Its low 32
+// bits are the index of the game's slot and its high 32 bits are the
+// generation of that slot, i.e. how many games it has hosted, so that
+// the id of a game that has ended never refers to the game that takes
+// its slot. NO_GAME is never the id of a game.
+typedef uint64_t GameId;
+const GameId NO_GAME = 0;
+
+// Struct: GameSlot
+// ================
+// Holds the state of a game hosted by a SessionManager: its Position,
+// which is all that is needed to validate and play its moves, a couple
+// of flags and the halfmove clock for the fifty-move rule. Repetitions
+// are not looked for, as that would take a history of hashes far bigger
+// than the slot, but a game going round in circles still ends by the
+// fifty-move rule. A slot takes well under 200 bytes.
+struct GameSlot {
+    Position position;      // Current position of the game.
+    uint32_t generation;    // Games hosted by this slot so far.
+    bool isActive;          // Whether the slot hosts a game.
+    bool isGameOver;        // Whether that game has ended.
+    int halfmoveClock;      // Moves since a capture or Pawn move.
+};
+
+// Class: SessionManager
+// =====================
+// This class hosts many games of chess at once in a single process. A
+// ChessBoard keeps a map of squares and a set of polymorphic pieces on
+// the heap, which takes a few kilobytes spread across memory, so it is
+// meant for a game played on the console. A SessionManager instead
+// keeps each game in a fixed-size GameSlot, all of them allocated
+// together in one slab when it is constructed, and plays moves on the
+// slot's Position directly. Starting, playing and ending games thus
+// never allocates, and a server can keep a hundred thousand games in a
+// few tens of megabytes. Free slots are kept on a stack, so that the
+// slot of the game ended last, still likely in cache, is reused first.
+//
+// A SessionManager is not thread-safe: games are meant to be shared out
+// between threads by giving each thread a SessionManager of its own.
+class SessionManager {
+
+    private:
+
+        vector<GameSlot> slots;         // One per game that can be hosted.
+        vector<uint32_t> freeSlots;     // Indices of the free slots.
+
+        // Method: findSlot
+        // ================
+        // Takes a GameId and returns the slot of that game,
+        // or a nullptr if it is not hosted here any longer.
+        GameSlot* findSlot(GameId gameId);
+        const GameSlot* findSlot(GameId gameId) const;
+
+    public:
+
+        // Constructor:
+        // ============
+        // Takes the number of games that can be hosted at once
+        // and allocates a slot for each of them up front.
+        SessionManager(size_t capacity);
+
+        // Method: createGame
+        // ==================
+        // Starts a new game from the initial position and returns its
+        // GameId, or NO_GAME if every slot is taken.
+        GameId createGame();
+
+        // Method: createGame
+        // ==================
+        // Starts a new game from the given Position and returns its
+        // GameId, or NO_GAME if every slot is taken.
+        GameId createGame(const Position& position);
+
+        // Method: endGame
+        // ===============
+        // Ends the game with the given GameId and frees its slot.
+        // Returns false if there is no such game.
+        bool endGame(GameId gameId);
+
+        // Method: submitMove
+        // ==================
+        // Takes a GameId and a Move and plays the Move in that game if
+        // it is valid. Returns a MoveResult describing the outcome, with
+        // NoGameStatus if there is no such game.
+        MoveResult submitMove(GameId gameId, Move move);
+
+        // Method: getPosition
+        // ===================
+        // Returns the current Position of the game with the given
+        // GameId, or a nullptr if there is no such game.
+        const Position* getPosition(GameId gameId) const;
+
+        // Method: isGameOver
+        // ==================
+        // Returns true if the game with the given GameId has ended in
+        // checkmate or stalemate, or if there is no such game.
+        bool isGameOver(GameId gameId) const;
+
+        // Method: getSize
+        // ===============
+        // Returns the number of games being hosted.
+        size_t getSize() const;
+
+        // Method: getCapacity
+        // ===================
+        // Returns the number of games that can be hosted at once.
+        size_t getCapacity() const;
+};
+
+#endif
@@ -25,58 +25,210 @@ const int NUM_SQUARES = SIDE_LEN * SIDE_LEN;
 // Constants: Set
 // ==============
 const int PIECES_PER_SIDE = 16;
-const string CHESS_PIECE_NAME = "Piece";
-const string WHITE_SYMBOL = "W";
-const string BLACK_SYMBOL = "B";
+const char CHESS_PIECE_NAME[] = "Piece";
+const char WHITE_SYMBOL[] = "W";
+const char BLACK_SYMBOL[] = "B";
 
 // Constants: Pawns
 // ================
 const int BLACK_PAWNS = 7;
 const int WHITE_PAWNS = 2;
-const string WHITE_PAWN = "\u2659";
-const string BLACK_PAWN = "\u265F";
-const string PAWN_NAME = "Pawn";
+const char WHITE_PAWN[] = "\u2659";
+const char BLACK_PAWN[] = "\u265F";
+const char PAWN_NAME[] = "Pawn";
 
 // Constants: Knights
 // ==================
 const char L_KNIGHT = 'B';
 const char R_KNIGHT = 'G';
-const string WHITE_KNIGHT = "\u2658";
-const string BLACK_KNIGHT = "\u265E";
-const string KNIGHT_NAME = "Knight";
+const char WHITE_KNIGHT[] = "\u2658";
+const char BLACK_KNIGHT[] = "\u265E";
+const char KNIGHT_NAME[] = "Knight";
 
 // Constants: Bishops
 // ==================
 const char L_BISHOP = 'C';
 const char R_BISHOP = 'F';
-const string WHITE_BISHOP = "\u2657";
-const string BLACK_BISHOP = "\u265D";
-const string BISHOP_NAME = "Bishop";
+const char WHITE_BISHOP[] = "\u2657";
+const char BLACK_BISHOP[] = "\u265D";
+const char BISHOP_NAME[] = "Bishop";
 
 // Constants: Rooks
 // ================
 const char L_ROOK = 'A';
 const char R_ROOK = 'H';
-const string WHITE_ROOK = "\u2656";
-const string BLACK_ROOK = "\u265C";
-const string ROOK_NAME = "Rook";
+const char WHITE_ROOK[] = "\u2656";
+const char BLACK_ROOK[] = "\u265C";
+const char ROOK_NAME[] = "Rook";
 
 // Constants: Queen
 // ================
 const char QUEEN = 'D';
-const string WHITE_QUEEN = "\u2655";
-const string BLACK_QUEEN = "\u265B";
-const string QUEEN_NAME = "Queen";
+const char WHITE_QUEEN[] = "\u2655";
+const char BLACK_QUEEN[] = "\u265B";
+const char QUEEN_NAME[] = "Queen";
 
 // Constants: King
 // ===============
 const char KING = 'E';
-const string WHITE_KING = "\u2654";
-const string BLACK_KING = "\u265A";
-const string KING_NAME = "King";
+const char WHITE_KING[] = "\u2654";
+const char BLACK_KING[] = "\u265A";
+const char KING_NAME[] = "King";
 const string WHITE_KING_SQUARE = "E1";
 const string BLACK_KING_SQUARE = "E8";
 
+// Constants: Piece Values
+// =======================
+// The value of each piece in centipawns, indexed by PieceType. The
+// King is given a large value so that exchanges ending in its capture
+// are never considered profitable by the static exchange evaluation.
+const int PIECE_VALUES[] = {100, 320, 330, 500, 900, 20000, 0};
+
+// Constants: Evaluation
+// =====================
+// The middlegame and endgame values of each piece used by the
+// evaluation, indexed by PieceType. The game phase is the sum of
+// PHASE_WEIGHTS over the pieces on the board, which is MAX_PHASE
+// with all pieces in play and falls towards 0 as they are traded.
+const int MG_PIECE_VALUES[] = {100, 320, 330, 500, 900, 0, 0};
+const int EG_PIECE_VALUES[] = {120, 300, 320, 530, 950, 0, 0};
+const int PHASE_WEIGHTS[] = {0, 1, 1, 2, 4, 0, 0};
+const int MAX_PHASE = 24;
+
+// Constants: Pawn Structure
+// =========================
+// Middlegame and endgame penalties for weak Pawns and bonuses for
+// passed Pawns, the latter indexed by rank from the Pawn's own side.
+// A passed Pawn on the last rank cannot move on, as Pawns do not
+// promote, so it gets no bonus. Each Pawn in front of its King is
+// worth a middlegame bonus depending on how far ahead of it it is.
+// The pawn hash table holds PAWN_TABLE_SIZE entries, a power of 2.
+const int DOUBLED_PAWN_MG = 10;
+const int DOUBLED_PAWN_EG = 20;
+const int ISOLATED_PAWN_MG = 10;
+const int ISOLATED_PAWN_EG = 15;
+const int BACKWARD_PAWN_MG = 8;
+const int BACKWARD_PAWN_EG = 12;
+const int PASSED_PAWN_MG[] = {0, 5, 10, 15, 25, 40, 60, 0};
+const int PASSED_PAWN_EG[] = {0, 10, 15, 25, 40, 60, 90, 0};
+const int PAWN_SHIELD_MG[] = {0, 12, 6};
+const int PAWN_TABLE_SIZE = 1 << 16;
+
+// Constants: Search
+// =================
+// MATE_SCORE is the score of delivering checkmate right away. Mates
+// further down the tree score one less per ply, so that the search
+// always prefers the shortest mate, and any score beyond MATE_BOUND is
+// a forced mate. DELTA_MARGIN is the safety margin used when pruning
+// captures that cannot raise the score in quiescence.
+const int MAX_PLY = 128;
+const int MATE_SCORE = 32000;
+const int INFINITE_SCORE = MATE_SCORE + 1;
+const int MATE_BOUND = MATE_SCORE - MAX_PLY;
+const int DELTA_MARGIN = 200;
+
+// Constants: Selective Search
+// ===========================
+// ASPIRATION_WINDOW is the half-width of the first window searched
+// around the score of the previous iteration, from ASPIRATION_MIN_DEPTH
+// on. The null move is tried from NULL_MOVE_MIN_DEPTH on, with a
+// reduction of NULL_MOVE_REDUCTION plies plus one more every
+// NULL_MOVE_DEPTH_STEP plies of depth. Late moves are reduced from
+// LMR_MIN_DEPTH on, once LMR_MIN_MOVES moves have been searched. Quiet
+// moves are pruned up to FUTILITY_MAX_DEPTH when the static evaluation
+// plus FUTILITY_MARGINS[depth] cannot reach alpha.
+const int ASPIRATION_WINDOW = 30;
+const int ASPIRATION_MIN_DEPTH = 4;
+const int NULL_MOVE_MIN_DEPTH = 3;
+const int NULL_MOVE_REDUCTION = 2;
+const int NULL_MOVE_DEPTH_STEP = 6;
+const int LMR_MIN_DEPTH = 3;
+const int LMR_MIN_MOVES = 3;
+const int FUTILITY_MARGINS[] = {0, 150, 300};
+const int FUTILITY_MAX_DEPTH = 2;
+
+// Constants: Time Management
+// ==========================
+// Times are in milliseconds. MOVE_OVERHEAD is kept in hand for the
+// time it takes to send the move. Without a number of moves to go, the
+// remaining time is shared as if DEFAULT_MOVES_TO_GO moves were left.
+// A search may run for up to MAX_TIME_FACTOR times its share if the
+// best move keeps changing, and its share is scaled by the entry of
+// STABILITY_SCALES (in percent) matching the number of iterations the
+// best move has stayed the same. The clock and node limits are checked
+// every POLL_INTERVAL nodes, which must be a power of 2.
+const int MOVE_OVERHEAD = 5;
+const int DEFAULT_MOVES_TO_GO = 30;
+const int MAX_TIME_FACTOR = 5;
+const int STABILITY_SCALES[] = {160, 120, 100, 80, 60};
+const int MAX_STABILITY = 4;
+const int POLL_INTERVAL = 1024;
+
+// Constants: UCI
+// ==============
+// How the engine introduces itself to a program speaking the Universal
+// Chess Interface, and the name of its option for the network file.
+const string ENGINE_NAME = "Chess";
+const string ENGINE_AUTHOR = "Juan Carlos Farah";
+const string EVAL_FILE_OPTION = "EvalFile";
+
+// Constants: Draw Rules
+// ======================
+// A game is drawn once the same position has occurred REPETITION_LIMIT
+// times, or once FIFTY_MOVE_PLIES moves in a row, i.e. fifty by each
+// side, have been played without a capture or a Pawn move.
+const int REPETITION_LIMIT = 3;
+const int FIFTY_MOVE_PLIES = 100;
+
+// Constants: Cache Line
+// =====================
+// Data written by different threads is kept this many bytes
+// apart, so that it never shares a cache line.
+const size_t CACHE_LINE_SIZE = 64;
+
+// Constants: Move Events
+// =======================
+// Each ChessBoard keeps its last MOVE_EVENT_RING_SIZE MoveEvents for
+// its watchers to read. It must be a power of 2.
+const int MOVE_EVENT_RING_SIZE = 1 << 8;
+
+// Constants: Move Service
+// ========================
+// Each worker of a MoveService has a queue with room for
+// SERVICE_QUEUE_SIZE requests, which must be a power of 2, and takes
+// up to SERVICE_BATCH_SIZE of them off it at a time. An idle worker
+// polls its queue SERVICE_SPIN_COUNT times before it goes to sleep,
+// and checks it again at least every SERVICE_SLEEP_MICROSECONDS.
+const int SERVICE_QUEUE_SIZE = 1 << 14;
+const int SERVICE_BATCH_SIZE = 64;
+const int SERVICE_SPIN_COUNT = 1 << 12;
+const int SERVICE_SLEEP_MICROSECONDS = 1000;
+
+// Constants: Premoves
+// ====================
+// Each player may queue up to MAX_PREMOVES moves ahead of their turn.
+const int MAX_PREMOVES = 8;
+
+// Constants: Speculator
+// ======================
+// An idle Speculator checks for requests every
+// SPECULATOR_POLL_MICROSECONDS.
+const int SPECULATOR_POLL_MICROSECONDS = 1000;
+
+// Constants: History
+// ==================
+// A ChessBoard keeps a checkpoint of its game every
+// HISTORY_CHECKPOINT_PLIES moves, so that going to any move of
+// the game takes at most that many moves played or taken back.
+const int HISTORY_CHECKPOINT_PLIES = 16;
+
+// Constants: Variation Tree
+// =========================
+// A VariationTree keeps a snapshot of the Position at every node
+// VARIATION_SNAPSHOT_PLIES moves deep, so that going to any node
+// plays at most that many moves from the nearest snapshot.
+const int VARIATION_SNAPSHOT_PLIES = 16;
+
 // Constants: Formatting
 // =====================
 // This constants are used to print out the ChessBoard
@@ -0,0 +1,151 @@
+// ==========================================
+// File:    Speculator.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <chrono>
+#include <string>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+using namespace std;
+
+#include "Speculator.hpp"
+#include "MoveGenerator.hpp"
+#include "Settings.hpp"
+
+// Public Method: find
+// ===================
+// Takes the hash of the current Position of the game and a Move, and
+// returns the MoveResult of playing the Move if it is a ready reply.
+// The game is the only one to bump the requested generation, so if it
+// matches the ready one, the worker is done with the table for now.
+const MoveResult* ReplyTable::find(Key key, Move move) const {
+    if (this->ready.load(memory_order_acquire) !=
+        this->requested.load(memory_order_relaxed) || this->key != key) {
+        return nullptr;
+    }
+    for (int i = 0; i < this->moves.size(); ++i) {
+        if (this->moves[i] == move) return &this->results[i];
+    }
+    return nullptr;
+}
+
+// Constructor: Default
+// ====================
+// Starts the worker thread. On Linux it is scheduled as an idle thread,
+// so that it only ever runs on a core with nothing else to do.
+Speculator::Speculator()
+    : current(nullptr), isStopping(false) {
+    this->runner = thread(&Speculator::run, this);
+#ifdef __linux__
+    sched_param parameters = {};
+    pthread_setschedparam(this->runner.native_handle(), SCHED_IDLE,
+                          &parameters);
+#endif
+}
+
+// Destructor:
+// ===========
+// Drops every request left and waits for the worker to stop.
+Speculator::~Speculator() {
+    {
+        lock_guard<mutex> guard(this->lock);
+        this->jobs.clear();
+        this->isStopping = true;
+    }
+    this->wakeUp.notify_one();
+    this->runner.join();
+}
+
+// Public Method: request
+// ======================
+// Takes a ReplyTable and a Position and asks for the table to be filled
+// in with the replies to it. The new generation is published first, so
+// that the worker gives up on any earlier request for the same table.
+// The worker is not woken up, which would cost the game a system call
+// on every move: it finds the request the next time it polls.
+void Speculator::request(ReplyTable& table, const Position& position) {
+    uint64_t generation = table.requested.load(memory_order_relaxed) + 1;
+    table.requested.store(generation, memory_order_release);
+    {
+        lock_guard<mutex> guard(this->lock);
+        for (size_t i = 0; i < this->jobs.size(); ++i) {
+            if (this->jobs[i].table == &table) {
+                this->jobs[i].generation = generation;
+                this->jobs[i].position = position;
+                return;
+            }
+        }
+        this->jobs.push_back(SpeculationJob{&table, generation, position});
+    }
+}
+
+// Public Method: cancel
+// =====================
+// Takes a ReplyTable, drops any request for it and waits until
+// the worker is not filling it in.
+void Speculator::cancel(const ReplyTable& table) {
+    unique_lock<mutex> guard(this->lock);
+    for (size_t i = 0; i < this->jobs.size(); ++i) {
+        if (this->jobs[i].table == &table) {
+            this->jobs.erase(this->jobs.begin() + i);
+            break;
+        }
+    }
+    this->done.wait(guard, [&] { return this->current != &table; });
+}
+
+// Private Method: run
+// ===================
+// Takes requests off the queue, oldest first, and fills in their
+// tables until the Speculator is destroyed. While there is none, it
+// checks the queue every SPECULATOR_POLL_MICROSECONDS.
+void Speculator::run() {
+    chrono::microseconds interval(SPECULATOR_POLL_MICROSECONDS);
+    unique_lock<mutex> guard(this->lock);
+    while (true) {
+        this->wakeUp.wait_for(guard, interval, [&] {
+            return this->isStopping || !this->jobs.empty();
+        });
+        if (this->isStopping) return;
+        if (this->jobs.empty()) continue;
+
+        SpeculationJob job = this->jobs.front();
+        this->jobs.pop_front();
+        this->current = job.table;
+        guard.unlock();
+
+        this->fill(job);
+
+        guard.lock();
+        this->current = nullptr;
+        this->done.notify_all();
+    }
+}
+
+// Private Method: fill
+// ====================
+// Plays every legal move on a copy of the Position of the request and
+// records its MoveResult. The game cannot read the table until the
+// ready generation is set to that of the request, which is done last.
+void Speculator::fill(const SpeculationJob& job) {
+    ReplyTable& table = *job.table;
+    if (table.requested.load(memory_order_acquire) != job.generation) {
+        return;
+    }
+
+    table.moves.clear();
+    MoveGenerator(job.position).generateLegal(table.moves);
+    for (int i = 0; i < table.moves.size(); ++i) {
+        if (table.requested.load(memory_order_relaxed) != job.generation) {
+            return;
+        }
+        Position position = job.position;
+        table.results[i] = playMove(position, table.moves[i]);
+    }
+    table.key = job.position.getKey();
+    table.ready.store(job.generation, memory_order_release);
+}
@@ -0,0 +1,120 @@
+// ==========================================
+// File:    Speculator.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef SPECULATOR_HPP
+#define SPECULATOR_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+using namespace std;
+
+#include "Position.hpp"
+#include "MoveResult.hpp"
+#include "Move.hpp"
+
+// Struct: ReplyTable
+// ==================
+// Holds every legal move in a Position along with the MoveResult of
+// playing it, as worked out ahead of time by a Speculator. The game the
+// table belongs to bumps the requested generation each time it asks for
+// the replies to a new Position, and the Speculator sets the ready
+// generation to the same value once it has filled them in, so the
+// table may only be read while both are the same.
+struct ReplyTable {
+    Key key;                        // Hash of the Position.
+    MoveList moves;                 // Every legal move.
+    MoveResult results[MAX_MOVES];  // The outcome of each of them.
+    atomic<uint64_t> requested;     // Generation asked for by the game.
+    atomic<uint64_t> ready;         // Generation filled in.
+
+    ReplyTable() : key(0), requested(0), ready(0) {}
+
+    // Method: find
+    // ============
+    // Takes the hash of the current Position of the game and a Move,
+    // and returns the MoveResult of playing the Move if the replies to
+    // that Position are ready and it is one of them, or a nullptr.
+    const MoveResult* find(Key key, Move move) const;
+};
+
+// Struct: SpeculationJob
+// ======================
+// A request for a Speculator to fill in a ReplyTable for a Position.
+struct SpeculationJob {
+    ReplyTable* table;      // Table to fill in.
+    uint64_t generation;    // Generation of the request.
+    Position position;      // Position to find the replies to.
+};
+
+// Class: Speculator
+// =================
+// This class uses the time a player spends thinking to validate the
+// moves they may reply with before they submit one. After each move
+// accepted in a game that has a Speculator, the game asks it for the
+// replies to the new Position, and a worker thread running at the
+// lowest priority plays every legal move on a copy of the Position,
+// recording whether it checks, checkmates or stalemates in the game's
+// ReplyTable. Submitting any of those moves then costs a lookup and
+// playing the move, instead of the validation and the search for a
+// legal reply. A request that is overtaken by the next move of its
+// game before it is done is dropped, so a worker never falls behind.
+// One Speculator may serve any number of games.
+class Speculator {
+
+    private:
+
+        deque<SpeculationJob> jobs;     // Requests not yet started.
+        const ReplyTable* current;      // Table being filled in, if any.
+        bool isStopping;                // Whether the worker should stop.
+        mutex lock;                     // Guards the members above.
+        condition_variable wakeUp;      // Signalled when stopping.
+        condition_variable done;        // Signalled when a job is done.
+        thread runner;                  // Thread running the worker.
+
+        // Method: run
+        // ===========
+        // Takes requests off the queue and fills in their tables
+        // until the Speculator is destroyed.
+        void run();
+
+        // Method: fill
+        // ============
+        // Fills in the table of a request, giving up as soon as
+        // its game asks for the replies to another Position.
+        void fill(const SpeculationJob& job);
+
+    public:
+
+        // Constructor: Default
+        // ====================
+        // Starts the worker thread.
+        Speculator();
+
+        // Destructor:
+        // ===========
+        // Drops every request left and waits for the worker to stop.
+        ~Speculator();
+
+        // Method: request
+        // ===============
+        // Takes a ReplyTable and a Position, which is copied, and asks
+        // for the table to be filled in with the replies to it. Any
+        // earlier request for the same table still waiting is replaced.
+        void request(ReplyTable& table, const Position& position);
+
+        // Method: cancel
+        // ==============
+        // Takes a ReplyTable, drops any request for it and waits until
+        // the worker is not filling it in, after which the table may
+        // be destroyed.
+        void cancel(const ReplyTable& table);
+};
+
+#endif
@@ -0,0 +1,136 @@
+// ==========================================
+// File:    SpmcRing.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef SPMC_RING_HPP
+#define SPMC_RING_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+using namespace std;
+
+#include "Settings.hpp"
+
+// Enum: ReadStatus
+// ================
+// The outcome of reading a value off an SpmcRing: it was read, it has
+// not been published yet, or it has already been overwritten.
+enum ReadStatus {ReadDone, ReadEmpty, ReadOverrun};
+
+// Class: SpmcRing
+// ===============
+// This class is a ring of the last values published by a single thread,
+// which any number of threads may read without locks. Every value has
+// a position, counting from 0 in the order they are published, and
+// each reader keeps the position of the next value it wants, so readers
+// never hold each other or the writer up. The writer never waits: once
+// the ring is full, each value overwrites the oldest one, and a reader
+// that has fallen that far behind is told so and must catch up by other
+// means. Each cell is guarded by a sequence number like a SeqLock, so
+// that a reader never returns a value that was overwritten while it was
+// being copied. The capacity must be a power of 2.
+template <typename T>
+class SpmcRing {
+
+    static_assert(is_trivially_copyable<T>::value,
+                  "An SpmcRing can only hold trivially copyable values.");
+
+    private:
+
+        static const size_t NUM_WORDS = (sizeof(T) + 7) / 8;
+
+        // Struct: Cell
+        // ============
+        // A value of the ring, kept in atomic words, and its sequence
+        // number: twice its position plus 1 while it is written and
+        // plus 2 once it is published.
+        struct Cell {
+            atomic<uint64_t> sequence;
+            atomic<uint64_t> words[NUM_WORDS];
+        };
+
+        vector<Cell> cells;             // The ring of cells.
+        size_t mask;                    // Capacity minus one.
+        alignas(CACHE_LINE_SIZE) atomic<uint64_t> head; // Values published.
+
+        // Copying would copy the values of a live ring.
+        SpmcRing(const SpmcRing& other);
+        SpmcRing& operator=(const SpmcRing& other);
+
+    public:
+
+        // Constructor:
+        // ============
+        // Takes the capacity of the ring, which must be a power of 2.
+        SpmcRing(size_t capacity)
+            : cells(capacity), mask(capacity - 1), head(0) {
+            for (size_t i = 0; i < capacity; ++i) {
+                this->cells[i].sequence.store(0, memory_order_relaxed);
+            }
+        }
+
+        // Method: publish
+        // ===============
+        // Publishes a value at the next position, overwriting the oldest
+        // value if the ring is full. Must only be called from one thread.
+        void publish(const T& value) {
+            uint64_t buffer[NUM_WORDS] = {0};
+            memcpy(buffer, &value, sizeof(T));
+
+            uint64_t position = this->head.load(memory_order_relaxed);
+            Cell& cell = this->cells[position & this->mask];
+            cell.sequence.store(2 * position + 1, memory_order_relaxed);
+            atomic_thread_fence(memory_order_release);
+            for (size_t i = 0; i < NUM_WORDS; ++i) {
+                cell.words[i].store(buffer[i], memory_order_relaxed);
+            }
+            cell.sequence.store(2 * position + 2, memory_order_release);
+            this->head.store(position + 1, memory_order_release);
+        }
+
+        // Method: read
+        // ============
+        // Takes a position and copies the value published there into the
+        // given variable. May be called from any thread. Returns whether
+        // the value was read, is yet to be published, or is gone.
+        ReadStatus read(uint64_t position, T& value) const {
+            const Cell& cell = this->cells[position & this->mask];
+            uint64_t before = cell.sequence.load(memory_order_acquire);
+            if (before < 2 * position + 2) return ReadEmpty;
+            if (before > 2 * position + 2) return ReadOverrun;
+
+            uint64_t buffer[NUM_WORDS];
+            for (size_t i = 0; i < NUM_WORDS; ++i) {
+                buffer[i] = cell.words[i].load(memory_order_relaxed);
+            }
+            atomic_thread_fence(memory_order_acquire);
+            if (cell.sequence.load(memory_order_relaxed) != before) {
+                return ReadOverrun;
+            }
+            memcpy(&value, buffer, sizeof(T));
+            return ReadDone;
+        }
+
+        // Method: getHead
+        // ===============
+        // Returns the number of values published so far, which is
+        // also the position of the next one.
+        uint64_t getHead() const {
+            return this->head.load(memory_order_acquire);
+        }
+
+        // Method: getCapacity
+        // ===================
+        // Returns the number of values the ring keeps.
+        size_t getCapacity() const {
+            return this->mask + 1;
+        }
+};
+
+#endif
@@ -0,0 +1,217 @@
+// ==========================================
+// File:    Termination.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <string>
+using namespace std;
+
+#include "Termination.hpp"
+#include "MoveResult.hpp"
+#include "MoveGenerator.hpp"
+
+// Function: hasMoveFrom
+// =====================
+// Takes a Position and a square and returns true if the piece on that
+// square belongs to the side to move and has a valid move. Only the
+// squares the piece could move to are tried, the first valid one ending
+// the search. A Pawn is tried on the squares it attacks and the two in
+// front of it, isPseudoLegal telling which of those it can move to.
+static bool hasMoveFrom(const Position& position, int square) {
+    Piece piece = position.pieceOn(square);
+    Color us = position.getSideToMove();
+    if (piece == NO_PIECE || colorOf(piece) != us) return false;
+
+    Bitboard occupied = position.getPieces();
+    Bitboard targets;
+    switch (typeOf(piece)) {
+        case PawnType: {
+            Bitboard bit = squareBit(square);
+            Bitboard ahead = (us == White)
+                             ? (bit << SIDE_LEN | bit << 2 * SIDE_LEN)
+                             : (bit >> SIDE_LEN | bit >> 2 * SIDE_LEN);
+            targets = (PAWN_ATTACKS[us][square] &
+                       position.getPieces(flip(us))) | ahead;
+            break;
+        }
+        case KnightType:
+            targets = KNIGHT_ATTACKS[square];
+            break;
+        case BishopType:
+            targets = bishopAttacks(square, occupied);
+            break;
+        case RookType:
+            targets = rookAttacks(square, occupied);
+            break;
+        case QueenType:
+            targets = queenAttacks(square, occupied);
+            break;
+        default:
+            targets = KING_ATTACKS[square];
+            break;
+    }
+    targets &= ~position.getPieces(us);
+
+    while (targets) {
+        Move move(square, popLsb(targets));
+        if (position.isPseudoLegal(move) && position.isLegal(move)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Function: hasLegalMove
+// ======================
+// Returns true if the side to move in the Position can make a valid
+// move. The King is tried first, as it can move in most positions.
+// When in check, the evasions are generated instead of trying each
+// piece in turn. Otherwise the piece on the hint square is tried next
+// and then every other piece, lowest square first.
+bool hasLegalMove(const Position& position, int hintSquare) {
+    Color us = position.getSideToMove();
+    int kingSquare = position.getKingSquare(us);
+    if (hasMoveFrom(position, kingSquare)) return true;
+
+    // In check, only the few moves that answer it need to be tried.
+    if (position.isInCheck(us)) {
+        MoveList moves;
+        MoveGenerator(position).generateEvasions(moves);
+        return !moves.isEmpty();
+    }
+
+    Bitboard pieces = position.getPieces(us) & ~squareBit(kingSquare);
+    if (hintSquare != NO_SQUARE && (pieces & squareBit(hintSquare))) {
+        if (hasMoveFrom(position, hintSquare)) return true;
+        pieces &= ~squareBit(hintSquare);
+    }
+    while (pieces) {
+        if (hasMoveFrom(position, popLsb(pieces))) return true;
+    }
+    return false;
+}
+
+// Function: isInsufficientMaterial
+// ================================
+// Returns true if neither side has the material left to checkmate.
+// Only a few Bitboards are looked at, so it is cheap enough to call
+// after every move.
+bool isInsufficientMaterial(const Position& position) {
+    if (position.getPieces(PawnType) | position.getPieces(RookType) |
+        position.getPieces(QueenType)) {
+        return false;
+    }
+
+    Bitboard knights = position.getPieces(KnightType);
+    Bitboard bishops = position.getPieces(BishopType);
+    if (popCount(knights | bishops) <= 1) return true;
+    if (knights) return false;
+    return !(bishops & LIGHT_SQUARES) || !(bishops & ~LIGHT_SQUARES);
+}
+
+// Function: applyDrawRules
+// ========================
+// Advances the halfmove clock and marks the MoveResult of a move that
+// has just been played if it draws the game by the fifty-move rule or
+// for insufficient material. A checkmate or stalemate is left as is.
+void applyDrawRules(const Position& position, int& halfmoveClock,
+                    MoveResult& result) {
+    if (result.moved == PawnType || result.isCapture()) {
+        halfmoveClock = 0;
+    } else {
+        ++halfmoveClock;
+    }
+    if (result.isGameOver()) return;
+
+    if (isInsufficientMaterial(position)) {
+        result.termination = InsufficientMaterialTermination;
+    } else if (halfmoveClock >= FIFTY_MOVE_PLIES) {
+        result.termination = FiftyMoveTermination;
+    }
+}
+
+// Constructor: Default
+// ====================
+TerminationDetector::TerminationDetector()
+    : halfmoveClock(0) {
+    this->history[0] = 0;
+    this->lastMoved[White] = NO_SQUARE;
+    this->lastMoved[Black] = NO_SQUARE;
+}
+
+// Public Method: reset
+// ====================
+// Takes the Position a game starts from and forgets
+// everything about any previous game.
+void TerminationDetector::reset(const Position& position) {
+    this->halfmoveClock = 0;
+    this->history[0] = position.getKey();
+    this->lastMoved[White] = NO_SQUARE;
+    this->lastMoved[Black] = NO_SQUARE;
+}
+
+// Private Method: isRepetition
+// ============================
+// Returns true if the current position has occurred REPETITION_LIMIT
+// times. Only every other position can be the same, as it must have
+// the same side to move, and only those since the last capture or Pawn
+// move, so at most FIFTY_MOVE_PLIES / 2 hashes are compared.
+bool TerminationDetector::isRepetition() const {
+    Key key = this->history[this->halfmoveClock];
+    int count = 1;
+    for (int i = this->halfmoveClock - 2; i >= 0; i -= 2) {
+        if (this->history[i] == key && ++count == REPETITION_LIMIT) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Public Method: record
+// =====================
+// Takes the Position after a move has been played and the MoveResult
+// of that move, and marks the MoveResult if the move has drawn the game.
+void TerminationDetector::record(const Position& position,
+                                 MoveResult& result) {
+    this->lastMoved[result.color] = result.to;
+    applyDrawRules(position, this->halfmoveClock, result);
+
+    // The fifty-move rule ends the game before the history overflows.
+    if (this->halfmoveClock > FIFTY_MOVE_PLIES) return;
+    this->history[this->halfmoveClock] = position.getKey();
+    if (!result.isGameOver() && this->isRepetition()) {
+        result.termination = RepetitionTermination;
+    }
+}
+
+// Public Method: restore
+// ======================
+// Takes the hashes of the positions since the last capture or Pawn
+// move, oldest first, the number of moves since then and the square of
+// the piece each Color moved last, and copies them in. At most
+// FIFTY_MOVE_PLIES + 1 hashes are copied, as record keeps no more.
+void TerminationDetector::restore(const Key* keys, int halfmoveClock,
+                                  int whiteLastMoved, int blackLastMoved) {
+    this->halfmoveClock = halfmoveClock;
+    for (int i = 0; i <= halfmoveClock && i <= FIFTY_MOVE_PLIES; ++i) {
+        this->history[i] = keys[i];
+    }
+    this->lastMoved[White] = whiteLastMoved;
+    this->lastMoved[Black] = blackLastMoved;
+}
+
+// Public Method: getHintSquare
+// ============================
+// Returns the square of the piece the given Color moved last,
+// or NO_SQUARE if it is unknown.
+int TerminationDetector::getHintSquare(Color color) const {
+    return this->lastMoved[color];
+}
+
+// Public Method: getHalfmoveClock
+// ===============================
+// Returns the number of moves played since the last capture or Pawn move.
+int TerminationDetector::getHalfmoveClock() const {
+    return this->halfmoveClock;
+}
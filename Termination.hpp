@@ -0,0 +1,123 @@
+// ==========================================
+// File:    Termination.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef TERMINATION_HPP
+#define TERMINATION_HPP
+
+#include <string>
+using namespace std;
+
+#include "Settings.hpp"
+#include "Bitboard.hpp"
+#include "Position.hpp"
+#include "Move.hpp"
+
+struct MoveResult;
+
+// Enum: Termination
+// =================
+// How a game has ended, if it has. Every ending but checkmate is a draw.
+enum Termination {NoTermination, CheckmateTermination, StalemateTermination,
+                  RepetitionTermination, FiftyMoveTermination,
+                  InsufficientMaterialTermination};
+
+// Function: hasLegalMove
+// ======================
+// Returns true if the side to move in the Position can make a valid
+// move. It stops at the first one found, trying the King first, then
+// the piece on the hint square, if any, and then every other piece, so
+// that in most positions only a handful of moves are ever looked at.
+// When in check, only the evasions are generated.
+bool hasLegalMove(const Position& position, int hintSquare = NO_SQUARE);
+
+// Function: isInsufficientMaterial
+// ================================
+// Returns true if neither side has the material left to checkmate,
+// i.e. there are only Kings and either a single Knight or Bishop, or
+// any number of Bishops all standing on squares of the same colour.
+bool isInsufficientMaterial(const Position& position);
+
+// Function: applyDrawRules
+// ========================
+// Takes the Position after a move has been played, the MoveResult of
+// that move and the halfmove clock, i.e. the number of moves played
+// since the last capture or Pawn move, which it advances. If the game
+// is now drawn by the fifty-move rule or for insufficient material, it
+// marks the MoveResult as such. Repetitions are not looked for, as that
+// takes the history of the game, which is kept by a TerminationDetector.
+void applyDrawRules(const Position& position, int& halfmoveClock,
+                    MoveResult& result);
+
+// Class: TerminationDetector
+// ==========================
+// This class follows a game move by move to tell when it is drawn: by
+// the fifty-move rule, for insufficient material or because the same
+// position has occurred REPETITION_LIMIT times. Positions can only
+// repeat between captures and Pawn moves, none of which can be taken
+// back, so it keeps the hashes of the positions since the last one
+// only, which are at most FIFTY_MOVE_PLIES. It also remembers the
+// piece each side moved last, which is a good first guess at a piece
+// with a legal move for hasLegalMove. Nothing is allocated.
+class TerminationDetector {
+
+    private:
+
+        Key history[FIFTY_MOVE_PLIES + 1];  // Since the last capture or
+                                            // Pawn move, the oldest first.
+        int halfmoveClock;                  // Moves since then.
+        int lastMoved[2];                   // Square of the piece each
+                                            // Color moved last.
+
+        // Method: isRepetition
+        // ====================
+        // Returns true if the current position has occurred
+        // REPETITION_LIMIT times.
+        bool isRepetition() const;
+
+    public:
+
+        // Constructor: Default
+        // ====================
+        TerminationDetector();
+
+        // Method: reset
+        // =============
+        // Takes the Position a game starts from and forgets
+        // everything about any previous game.
+        void reset(const Position& position);
+
+        // Method: record
+        // ==============
+        // Takes the Position after a move has been played and the
+        // MoveResult of that move, and marks the MoveResult if the
+        // move has drawn the game. A game that has already ended in
+        // checkmate or stalemate is left as is.
+        void record(const Position& position, MoveResult& result);
+
+        // Method: restore
+        // ===============
+        // Takes the hashes of the positions since the last capture or
+        // Pawn move, oldest first, the number of moves since then and
+        // the square of the piece each Color moved last, and carries
+        // on as if those moves had just been recorded, e.g. after
+        // moves are taken back.
+        void restore(const Key* keys, int halfmoveClock,
+                     int whiteLastMoved, int blackLastMoved);
+
+        // Method: getHintSquare
+        // =====================
+        // Returns the square of the piece the given Color moved last,
+        // to be passed to hasLegalMove, or NO_SQUARE if it is unknown.
+        int getHintSquare(Color color) const;
+
+        // Method: getHalfmoveClock
+        // ========================
+        // Returns the number of moves played since the last
+        // capture or Pawn move.
+        int getHalfmoveClock() const;
+};
+
+#endif
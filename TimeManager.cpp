@@ -0,0 +1,78 @@
+// ==========================================
+// File:    TimeManager.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <algorithm>
+using namespace std;
+
+#include "TimeManager.hpp"
+#include "Settings.hpp"
+
+// Constructor: Default
+// ====================
+// Constructs a TimeManager with no time limit.
+TimeManager::TimeManager()
+    : start(chrono::steady_clock::now()), optimumTime(0), maximumTime(0),
+      softTime(0), stability(0), isTimed(false) {}
+
+// Public Method: init
+// ===================
+// Takes the limits of a search and the Color to move, starts the clock
+// and works out the deadlines of the search. A fixed move time is used
+// up to the last millisecond but MOVE_OVERHEAD. With a clock, the side
+// to move gets an even share of its remaining time over the moves to
+// go plus most of its increment, and may spend up to MAX_TIME_FACTOR
+// times as much, but never more than the time left on its clock.
+void TimeManager::init(const SearchLimits& limits, Color us) {
+    this->start = chrono::steady_clock::now();
+    this->stability = 0;
+    this->isTimed = true;
+
+    if (limits.isInfinite || limits.isPonder) {
+        this->isTimed = false;
+        this->optimumTime = 0;
+        this->maximumTime = 0;
+    } else if (limits.moveTime > 0) {
+        this->maximumTime = max<int64_t>(limits.moveTime - MOVE_OVERHEAD, 1);
+        this->optimumTime = this->maximumTime;
+    } else if (limits.time[us] > 0) {
+        int movesToGo = (limits.movesToGo > 0) ? limits.movesToGo
+                                               : DEFAULT_MOVES_TO_GO;
+        int64_t timeLeft = max<int64_t>(limits.time[us] - MOVE_OVERHEAD, 1);
+        this->optimumTime = timeLeft / movesToGo +
+                            limits.increment[us] * 3 / 4;
+        this->maximumTime = min(this->optimumTime * MAX_TIME_FACTOR,
+                                timeLeft * 4 / 5);
+        this->maximumTime = max<int64_t>(this->maximumTime, 1);
+        this->optimumTime = min(this->optimumTime, this->maximumTime);
+    } else {
+        this->isTimed = false;
+        this->optimumTime = 0;
+        this->maximumTime = 0;
+    }
+    this->softTime = this->optimumTime;
+}
+
+// Public Method: update
+// =====================
+// Called after each completed iteration with whether the best move
+// changed in it. A best move that keeps changing means the search has
+// not made up its mind yet and deserves more time, whereas one that has
+// stayed the same for several iterations is unlikely to change anymore.
+void TimeManager::update(bool hasBestMoveChanged) {
+    this->stability = hasBestMoveChanged
+                    ? 0 : min(this->stability + 1, MAX_STABILITY);
+    this->softTime = min(this->optimumTime *
+                         STABILITY_SCALES[this->stability] / 100,
+                         this->maximumTime);
+}
+
+// Public Method: getElapsed
+// =========================
+// Returns the time elapsed since init in milliseconds.
+int64_t TimeManager::getElapsed() const {
+    return chrono::duration_cast<chrono::milliseconds>(
+               chrono::steady_clock::now() - this->start).count();
+}
@@ -0,0 +1,100 @@
+// ==========================================
+// File:    TimeManager.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef TIME_MANAGER_HPP
+#define TIME_MANAGER_HPP
+
+#include <chrono>
+#include <cstdint>
+using namespace std;
+
+#include "ChessPiece.hpp"
+
+// Struct: SearchLimits
+// ====================
+// Holds the limits of a search. Times are in milliseconds and a limit
+// of 0 means that there is none. A search with no limit at all runs
+// until it is stopped from outside. An infinite search ignores its
+// time limits, and so does a ponder search until it is told that the
+// opponent played the expected move (a ponder hit).
+struct SearchLimits {
+    int64_t moveTime;       // Exact time to spend on the move.
+    int64_t time[2];        // Time left on the clock of each Color.
+    int64_t increment[2];   // Increment per move of each Color.
+    int movesToGo;          // Moves left until the next time control.
+    uint64_t nodes;         // Maximum number of nodes to search.
+    int depth;              // Maximum depth to search to.
+    bool isInfinite;        // Whether to search until stopped.
+    bool isPonder;          // Whether to search until a ponder hit.
+
+    SearchLimits()
+        : moveTime(0), movesToGo(0), nodes(0), depth(0), isInfinite(false),
+          isPonder(false) {
+        time[White] = time[Black] = 0;
+        increment[White] = increment[Black] = 0;
+    }
+};
+
+// Class: TimeManager
+// ==================
+// This class decides how long a search may run given its SearchLimits.
+// It works with two deadlines. The soft deadline is checked between
+// iterations of the search: no new iteration is started past it, as it
+// would most likely not finish in time. It is stretched when the best
+// move changed in the last iteration and shrunk when the best move has
+// stayed the same for a while. The hard deadline is checked during the
+// iterations, and the search is abandoned as soon as it is reached.
+class TimeManager {
+
+    private:
+
+        chrono::steady_clock::time_point start; // Start of the search.
+        int64_t optimumTime;        // Share of the time for this move.
+        int64_t maximumTime;        // Hard deadline, from the start.
+        int64_t softTime;           // Soft deadline, from the start.
+        int stability;              // Iterations with the same best move.
+        bool isTimed;               // Whether there is a time limit.
+
+    public:
+
+        // Constructor: Default
+        // ====================
+        // Constructs a TimeManager with no time limit.
+        TimeManager();
+
+        // Method: init
+        // ============
+        // Takes the limits of a search and the Color to move, starts
+        // the clock and works out the deadlines of the search.
+        void init(const SearchLimits& limits, Color us);
+
+        // Method: update
+        // ==============
+        // Called after each completed iteration with whether the best
+        // move changed in it, to move the soft deadline accordingly.
+        void update(bool hasBestMoveChanged);
+
+        // Method: getElapsed
+        // ==================
+        // Returns the time elapsed since init in milliseconds.
+        int64_t getElapsed() const;
+
+        // Method: isSoftDeadlinePassed
+        // ============================
+        // Returns true if no new iteration should be started.
+        bool isSoftDeadlinePassed() const {
+            return this->isTimed && this->getElapsed() >= this->softTime;
+        }
+
+        // Method: isHardDeadlinePassed
+        // ============================
+        // Returns true if the search must stop right away.
+        bool isHardDeadlinePassed() const {
+            return this->isTimed && this->getElapsed() >= this->maximumTime;
+        }
+};
+
+#endif
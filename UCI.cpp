@@ -0,0 +1,329 @@
+// ==========================================
+// File:    UCI.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <cctype>
+using namespace std;
+
+#include "UCI.hpp"
+#include "MoveGenerator.hpp"
+#include "Settings.hpp"
+
+// Constants: Starting Position
+// ============================
+const string START_FEN =
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w - - 0 1";
+
+// Constructor:
+// ============
+// Takes the streams to read commands from and write output to.
+UCI::UCI(istream& in, ostream& out)
+    : in(in), writer(out), board(true), position(board.getPosition()),
+      stopSignal(false), search(nullptr), isWaiting(false),
+      isPonderHitPending(false) {}
+
+// Destructor:
+// ===========
+// Stops any running search and waits for it to finish.
+UCI::~UCI() {
+    this->handleStop();
+    this->waitForSearch();
+}
+
+// Public Method: loop
+// ===================
+// Reads and handles commands until quit or the end of input. Unknown
+// commands are ignored, as the protocol requires.
+void UCI::loop() {
+    string line;
+    while (getline(this->in, line)) {
+        istringstream ss(line);
+        string command;
+        ss >> command;
+
+        if (command == "uci") {
+            this->handleUci();
+        } else if (command == "isready") {
+            this->writer.send("readyok");
+        } else if (command == "setoption") {
+            this->waitForSearch();
+            this->handleSetOption(ss);
+        } else if (command == "ucinewgame") {
+            this->waitForSearch();
+            this->board.resetBoard();
+            this->position = this->board.getPosition();
+        } else if (command == "position") {
+            this->waitForSearch();
+            this->handlePosition(ss);
+        } else if (command == "go") {
+            this->waitForSearch();
+            this->handleGo(ss);
+        } else if (command == "stop") {
+            this->handleStop();
+        } else if (command == "ponderhit") {
+            this->handlePonderHit();
+        } else if (command == "quit") {
+            break;
+        }
+    }
+    this->handleStop();
+    this->waitForSearch();
+}
+
+// Private Method: handleUci
+// =========================
+// Introduces the engine and lists its options in a single write.
+void UCI::handleUci() {
+    this->writer.writeLine("id name " + ENGINE_NAME);
+    this->writer.writeLine("id author " + ENGINE_AUTHOR);
+    this->writer.writeLine("option name " + EVAL_FILE_OPTION +
+                           " type string default <empty>");
+    this->writer.writeLine("option name Ponder type check default false");
+    this->writer.send("uciok");
+}
+
+// Private Method: handleSetOption
+// ===============================
+// Takes the rest of a setoption command, of the form "name <id> [value
+// <x>]", and sets the option. Only the network file is used by the
+// engine; Ponder is declared for the benefit of the GUI.
+void UCI::handleSetOption(istringstream& ss) {
+    string token;
+    string name;
+    string value;
+    ss >> token;
+    while (ss >> token && token != "value") {
+        name += (name.empty() ? "" : " ") + token;
+    }
+    while (ss >> token) value += (value.empty() ? "" : " ") + token;
+
+    // Loading an empty path unloads the network, so that the
+    // material and piece-square evaluation is used again.
+    if (name == EVAL_FILE_OPTION) {
+        if (value == "<empty>") value.clear();
+        if (!this->network.load(value) && !value.empty()) {
+            this->writer.send("info string could not load " + value);
+        }
+    }
+}
+
+// Private Method: handlePosition
+// ==============================
+// Takes the rest of a position command, of the form "startpos [moves
+// ...]" or "fen <fen> [moves ...]", sets up the ChessBoard and plays
+// the moves. Playing stops at the first illegal move.
+void UCI::handlePosition(istringstream& ss) {
+    string token;
+    string fen;
+    ss >> token;
+    if (token == "startpos") {
+        fen = START_FEN;
+        ss >> token;
+    } else if (token == "fen") {
+        while (ss >> token && token != "moves") {
+            fen += (fen.empty() ? "" : " ") + token;
+        }
+    } else {
+        return;
+    }
+
+    if (!this->board.setPosition(fen)) {
+        this->writer.send("info string invalid position " + fen);
+        return;
+    }
+    this->position = this->board.getPosition();
+    while (ss >> token) {
+        if (!this->playMove(token)) {
+            this->writer.send("info string illegal move " + token);
+            return;
+        }
+    }
+}
+
+// Private Method: playMove
+// ========================
+// Takes a move in UCI notation and plays it on the Position if it is
+// one of its legal moves. Returns true only once it has been played.
+bool UCI::playMove(const string& notation) {
+    Move move = UCI::parseMove(notation);
+    if (move.isNull()) return false;
+
+    MoveList moves;
+    MoveGenerator(this->position).generateLegal(moves);
+    if (!moves.contains(move)) return false;
+    UndoInfo undo;
+    this->position.makeMove(move, undo);
+    return true;
+}
+
+// Private Method: handleGo
+// ========================
+// Takes the rest of a go command and starts a search with the given
+// limits on the search thread, leaving this thread free to read
+// commands. Unsupported limits, such as searchmoves, are ignored.
+void UCI::handleGo(istringstream& ss) {
+    SearchLimits limits;
+    string token;
+    while (ss >> token) {
+        if (token == "wtime") {
+            ss >> limits.time[White];
+        } else if (token == "btime") {
+            ss >> limits.time[Black];
+        } else if (token == "winc") {
+            ss >> limits.increment[White];
+        } else if (token == "binc") {
+            ss >> limits.increment[Black];
+        } else if (token == "movestogo") {
+            ss >> limits.movesToGo;
+        } else if (token == "depth") {
+            ss >> limits.depth;
+        } else if (token == "nodes") {
+            ss >> limits.nodes;
+        } else if (token == "movetime") {
+            ss >> limits.moveTime;
+        } else if (token == "infinite") {
+            limits.isInfinite = true;
+        } else if (token == "ponder") {
+            limits.isPonder = true;
+        }
+    }
+
+    this->stopSignal = false;
+    {
+        lock_guard<mutex> guard(this->searchLock);
+        this->isWaiting = limits.isInfinite || limits.isPonder;
+        this->isPonderHitPending = false;
+    }
+    this->searchThread = thread(&UCI::runSearch, this, this->position,
+                                limits);
+}
+
+// Private Method: handleStop
+// ==========================
+// Stops the current search, which then sends its best move.
+void UCI::handleStop() {
+    lock_guard<mutex> guard(this->searchLock);
+    this->stopSignal = true;
+    this->isWaiting = false;
+    this->searchEvent.notify_all();
+}
+
+// Private Method: handlePonderHit
+// ===============================
+// Tells the current ponder search that the expected move was played.
+// If it has already finished, its best move is sent right away. If its
+// thread has not registered it yet, the ponder hit is kept pending and
+// passed on as soon as it does, so that it is never lost.
+void UCI::handlePonderHit() {
+    lock_guard<mutex> guard(this->searchLock);
+    if (this->search != nullptr) {
+        this->search->ponderHit();
+    } else if (this->isWaiting) {
+        this->isPonderHitPending = true;
+    }
+    this->isWaiting = false;
+    this->searchEvent.notify_all();
+}
+
+// Private Method: waitForSearch
+// =============================
+// Blocks until the search thread, if any, has finished.
+void UCI::waitForSearch() {
+    if (this->searchThread.joinable()) this->searchThread.join();
+}
+
+// Private Method: runSearch
+// =========================
+// Runs on the search thread. Searches the given Position within the
+// given limits and reports each iteration. The protocol does not allow
+// an infinite or ponder search to send its best move before it is told
+// to stop or gets a ponder hit, so it waits for that if need be.
+void UCI::runSearch(Position position, SearchLimits limits) {
+    Search search(position);
+    search.setNetwork(this->network.isLoaded() ? &this->network : nullptr);
+    search.setOptions(this->options);
+    search.setStopSignal(&this->stopSignal);
+    OutputWriter& writer = this->writer;
+    search.setInfoCallback([&writer](const SearchInfo& info) {
+        writer.send(UCI::formatInfo(info));
+    });
+    {
+        lock_guard<mutex> guard(this->searchLock);
+        this->search = &search;
+        if (this->isPonderHitPending) {
+            search.ponderHit();
+            this->isPonderHitPending = false;
+        }
+    }
+
+    search.search(limits);
+
+    const vector<Move>& pv = search.getPrincipalVariation();
+    string line = "bestmove " + (search.getBestMove().isNull()
+                                 ? string("0000")
+                                 : UCI::formatMove(search.getBestMove()));
+    if (pv.size() > 1) line += " ponder " + UCI::formatMove(pv[1]);
+
+    unique_lock<mutex> guard(this->searchLock);
+    this->search = nullptr;
+    this->searchEvent.wait(guard, [this] { return !this->isWaiting; });
+    this->writer.send(line);
+}
+
+// Private Method: formatInfo
+// ==========================
+// Returns the info line reporting the given SearchInfo. Mate scores
+// are given in moves rather than centipawns, as the protocol requires.
+string UCI::formatInfo(const SearchInfo& info) {
+    ostringstream ss;
+    ss << "info depth " << info.depth << " score ";
+    if (info.score >= MATE_BOUND) {
+        ss << "mate " << (MATE_SCORE - info.score + 1) / 2;
+    } else if (info.score <= -MATE_BOUND) {
+        ss << "mate " << -(MATE_SCORE + info.score) / 2;
+    } else {
+        ss << "cp " << info.score;
+    }
+    int64_t time = info.time;
+    ss << " nodes " << info.nodes << " nps "
+       << (time > 0 ? info.nodes * 1000 / time : info.nodes)
+       << " time " << time << " pv";
+    for (size_t i = 0; i < info.principalVariation.size(); ++i) {
+        ss << " " << UCI::formatMove(info.principalVariation[i]);
+    }
+    return ss.str();
+}
+
+// Public Method: formatMove
+// =========================
+// Returns a Move in UCI notation, e.g. "e2e4".
+string UCI::formatMove(Move move) {
+    string notation;
+    notation += static_cast<char>(tolower(squareFile(move.getFrom())));
+    notation += static_cast<char>('0' + squareRank(move.getFrom()));
+    notation += static_cast<char>(tolower(squareFile(move.getTo())));
+    notation += static_cast<char>('0' + squareRank(move.getTo()));
+    return notation;
+}
+
+// Public Method: parseMove
+// ========================
+// Takes a move in UCI notation and returns the matching Move, or the
+// null Move if the notation is not that of a move. Pawns never
+// promote, so a promotion suffix makes the notation invalid.
+Move UCI::parseMove(const string& notation) {
+    if (notation.size() != 4) return Move();
+    int squares[2];
+    for (int i = 0; i < 2; ++i) {
+        char file = static_cast<char>(toupper(notation[2 * i]));
+        int rank = notation[2 * i + 1] - '0';
+        if (file < LEFTMOST_FILE || file > RIGHTMOST_FILE ||
+            rank < BOTTOM_RANK || rank > TOP_RANK) {
+            return Move();
+        }
+        squares[i] = squareIndex(file, rank);
+    }
+    return Move(squares[0], squares[1]);
+}
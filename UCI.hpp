@@ -0,0 +1,146 @@
+// ==========================================
+// File:    UCI.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef UCI_HPP
+#define UCI_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+using namespace std;
+
+#include "ChessBoard.hpp"
+#include "Network.hpp"
+#include "OutputWriter.hpp"
+#include "Search.hpp"
+
+// Class: UCI
+// ==========
+// This class lets the engine be driven by another program, such as a
+// tournament manager, through the Universal Chess Interface (UCI). It
+// reads commands line by line and sets up positions from FEN with a
+// quiet ChessBoard, so that doing so does not print anything. The moves
+// given after a position are played on a Position of its own, as the
+// ChessBoard ends a game by itself on draws, e.g. by repetition, which
+// under UCI are left for the GUI to claim. Searches run
+// on a thread of their own, so that commands such as stop, ponderhit
+// and isready are answered while the engine is thinking. All output
+// goes through a single OutputWriter shared by both threads.
+class UCI {
+
+    private:
+
+        istream& in;                // Stream the commands come from.
+        OutputWriter writer;        // Writer for all of the output.
+        ChessBoard board;           // Reads the positions set up.
+        Position position;          // Position to search from.
+        Network network;            // Network to evaluate with, if any.
+        SearchOptions options;      // Techniques used by the Search.
+
+        thread searchThread;        // Thread running the current search.
+        atomic<bool> stopSignal;    // Set to stop the current search.
+        mutex searchLock;           // Guards the members below.
+        condition_variable searchEvent; // Signals stop and ponderhit.
+        Search* search;             // Current search, while it runs.
+        bool isWaiting;             // Whether bestmove must wait.
+        bool isPonderHitPending;    // Whether a ponderhit came before
+                                    // the search was registered.
+
+        // Method: handleUci
+        // =================
+        // Introduces the engine and lists its options.
+        void handleUci();
+
+        // Method: handleSetOption
+        // =======================
+        // Takes the rest of a setoption command and sets the option.
+        void handleSetOption(istringstream& ss);
+
+        // Method: handlePosition
+        // ======================
+        // Takes the rest of a position command and sets up the
+        // ChessBoard from a FEN or the starting position, then plays
+        // the moves that follow, if any.
+        void handlePosition(istringstream& ss);
+
+        // Method: handleGo
+        // ================
+        // Takes the rest of a go command and starts a search with the
+        // given limits on the search thread.
+        void handleGo(istringstream& ss);
+
+        // Method: handleStop
+        // ==================
+        // Stops the current search, which then sends its best move.
+        void handleStop();
+
+        // Method: handlePonderHit
+        // =======================
+        // Tells the current ponder search that the expected move was
+        // played, so that it now plays by its time limits.
+        void handlePonderHit();
+
+        // Method: waitForSearch
+        // =====================
+        // Blocks until the search thread, if any, has finished.
+        void waitForSearch();
+
+        // Method: runSearch
+        // =================
+        // Runs on the search thread. Searches the given Position within
+        // the given limits, reports each iteration and sends the best
+        // move, but only once allowed to for infinite and ponder searches.
+        void runSearch(Position position, SearchLimits limits);
+
+        // Method: playMove
+        // ================
+        // Takes a move in UCI notation, e.g. "e2e4", and plays it on the
+        // Position. Returns false, playing nothing, if it is illegal.
+        bool playMove(const string& notation);
+
+        // Method: formatInfo
+        // ==================
+        // Returns the info line reporting the given SearchInfo.
+        static string formatInfo(const SearchInfo& info);
+
+        // Copying would copy the search thread.
+        UCI(const UCI& other);
+        UCI& operator=(const UCI& other);
+
+    public:
+
+        // Constructor:
+        // ============
+        // Takes the streams to read commands from and write output to.
+        UCI(istream& in, ostream& out);
+
+        // Destructor:
+        // ===========
+        // Stops any running search and waits for it to finish.
+        virtual ~UCI();
+
+        // Method: loop
+        // ============
+        // Reads and handles commands until quit or the end of input.
+        void loop();
+
+        // Method: formatMove
+        // ==================
+        // Returns a Move in UCI notation, e.g. "e2e4".
+        static string formatMove(Move move);
+
+        // Method: parseMove
+        // =================
+        // Takes a move in UCI notation and returns the matching Move, or
+        // the null Move if the notation is not that of a move.
+        static Move parseMove(const string& notation);
+};
+
+#endif
@@ -0,0 +1,21 @@
+// ==========================================
+// File:    UciMain.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include <iostream>
+using namespace std;
+
+#include "UCI.hpp"
+
+int main() {
+
+    // All output goes through the UCI's own buffered writer,
+    // so the standard streams do not need to be synchronised.
+    ios::sync_with_stdio(false);
+
+    UCI uci(cin, cout);
+    uci.loop();
+    return 0;
+}
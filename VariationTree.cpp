@@ -0,0 +1,231 @@
+// ==========================================
+// File:    VariationTree.cpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#include "VariationTree.hpp"
+
+// Constructor:
+// ============
+// Takes the Position the analysis starts from and makes a root
+// for it, which is also the first snapshot.
+VariationTree::VariationTree(const Position& start)
+    : position(start), current(0) {
+    VariationNode root;
+    root.captured = NO_PIECE;
+    root.glyph = 0;
+    root.score = NO_SCORE;
+    root.depth = 0;
+    root.parent = NO_NODE;
+    root.firstChild = NO_NODE;
+    root.nextSibling = NO_NODE;
+    root.transposition = 0;
+    this->nodes.push_back(root);
+    this->snapshots[0] = start;
+    this->firstByKey[start.getKey()] = 0;
+}
+
+// Private Method: walkDown
+// ========================
+// Plays the moves of the nodes in path, the last one first, i.e. from
+// the top of the tree down, and records what each of them captured.
+void VariationTree::walkDown() {
+    while (!this->path.empty()) {
+        int node = this->path.back();
+        this->path.pop_back();
+        UndoInfo undo;
+        this->position.makeMove(this->nodes[node].move, undo);
+        this->current = node;
+    }
+}
+
+// Private Method: stepBack
+// ========================
+// Takes back the move of the current node with what it captured,
+// and makes its parent the current node.
+void VariationTree::stepBack() {
+    const VariationNode& node = this->nodes[this->current];
+    UndoInfo undo;
+    undo.captured = node.captured;
+    this->position.unmakeMove(node.move, undo);
+    this->current = node.parent;
+}
+
+// Public Method: addMove
+// ======================
+// Takes a Move and plays it from the current node. If the current node
+// has a child for it already, that child becomes the current node.
+// Otherwise a child is added, linked in with the nodes reaching the
+// same position and, if it is deep enough, given a snapshot.
+int VariationTree::addMove(Move move) {
+    int child = this->nodes[this->current].firstChild;
+    while (child != NO_NODE) {
+        if (this->nodes[child].move == move) {
+            this->goTo(child);
+            return child;
+        }
+        child = this->nodes[child].nextSibling;
+    }
+    if (move.isNull() || !this->position.isPseudoLegal(move) ||
+        !this->position.isLegal(move)) {
+        return NO_NODE;
+    }
+
+    UndoInfo undo;
+    this->position.makeMove(move, undo);
+    VariationNode& parent = this->nodes[this->current];
+    VariationNode node;
+    node.move = move;
+    node.captured = undo.captured;
+    node.glyph = 0;
+    node.score = NO_SCORE;
+    node.depth = static_cast<uint16_t>(parent.depth + 1);
+    node.parent = this->current;
+    node.firstChild = NO_NODE;
+    node.nextSibling = parent.firstChild;
+    child = static_cast<int>(this->nodes.size());
+    parent.firstChild = child;
+
+    // Link the node into the ring of those reaching the same position.
+    Key key = this->position.getKey();
+    unordered_map<Key, int>::iterator first = this->firstByKey.find(key);
+    if (first == this->firstByKey.end()) {
+        node.transposition = child;
+        this->firstByKey[key] = child;
+    } else {
+        node.transposition = this->nodes[first->second].transposition;
+        this->nodes[first->second].transposition = child;
+    }
+
+    this->nodes.push_back(node);
+    if (node.depth % VARIATION_SNAPSHOT_PLIES == 0) {
+        this->snapshots[child] = this->position;
+    }
+    this->current = child;
+    return child;
+}
+
+// Public Method: goTo
+// ===================
+// Takes a node and makes it the current node. The moves down to the
+// node in common with the current one are taken back and those to the
+// given node are played, unless playing them from the snapshot above
+// the given node takes fewer moves, in which case that is done.
+bool VariationTree::goTo(int node) {
+    if (node < 0 || node >= this->getSize()) return false;
+
+    // Count the moves from the snapshot above the node.
+    const VariationNode* nodes = this->nodes.data();
+    int fromSnapshot = nodes[node].depth % VARIATION_SNAPSHOT_PLIES;
+
+    // Find the node in common and count the moves through it.
+    int up = this->current;
+    int down = node;
+    int steps = 0;
+    while (nodes[up].depth > nodes[down].depth) {
+        up = nodes[up].parent;
+        ++steps;
+    }
+    while (nodes[down].depth > nodes[up].depth) {
+        down = nodes[down].parent;
+        ++steps;
+    }
+    while (up != down) {
+        up = nodes[up].parent;
+        down = nodes[down].parent;
+        steps += 2;
+    }
+
+    this->path.clear();
+    if (steps > fromSnapshot) {
+        int snapshot = node;
+        for (int i = 0; i < fromSnapshot; ++i) {
+            this->path.push_back(snapshot);
+            snapshot = nodes[snapshot].parent;
+        }
+        this->position = this->snapshots.at(snapshot);
+        this->current = snapshot;
+    } else {
+        while (this->current != up) this->stepBack();
+        for (int step = node; step != up; step = nodes[step].parent) {
+            this->path.push_back(step);
+        }
+    }
+    this->walkDown();
+    return true;
+}
+
+// Public Method: getCurrent
+// =========================
+// Returns the current node.
+int VariationTree::getCurrent() const {
+    return this->current;
+}
+
+// Public Method: getPosition
+// ==========================
+// Returns the Position at the current node.
+const Position& VariationTree::getPosition() const {
+    return this->position;
+}
+
+// Public Method: getNode
+// ======================
+// Returns the VariationNode of the given node.
+const VariationNode& VariationTree::getNode(int node) const {
+    return this->nodes[node];
+}
+
+// Public Method: getSize
+// ======================
+// Returns the number of nodes, counting the root.
+int VariationTree::getSize() const {
+    return static_cast<int>(this->nodes.size());
+}
+
+// Public Method: findNode
+// =======================
+// Takes the hash of a position and returns the first
+// node added that reaches it, or NO_NODE.
+int VariationTree::findNode(Key key) const {
+    unordered_map<Key, int>::const_iterator first = this->firstByKey.find(key);
+    return (first == this->firstByKey.end()) ? NO_NODE : first->second;
+}
+
+// Public Method: setGlyph
+// =======================
+// Takes a node and a numeric annotation glyph and annotates the node.
+void VariationTree::setGlyph(int node, uint8_t glyph) {
+    this->nodes[node].glyph = glyph;
+}
+
+// Public Method: setScore
+// =======================
+// Takes a node and a score in centipawns, which is clamped to the
+// range of the node's score, and annotates the node with it.
+void VariationTree::setScore(int node, int score) {
+    if (score < NO_SCORE) score = NO_SCORE;
+    if (score > INT16_MAX) score = INT16_MAX;
+    this->nodes[node].score = static_cast<int16_t>(score);
+}
+
+// Public Method: setComment
+// =========================
+// Takes a node and a comment and annotates the node with it.
+void VariationTree::setComment(int node, const string& comment) {
+    if (comment.empty()) {
+        this->comments.erase(node);
+    } else {
+        this->comments[node] = comment;
+    }
+}
+
+// Public Method: getComment
+// =========================
+// Returns the comment of the given node, or an empty string.
+const string& VariationTree::getComment(int node) const {
+    static const string empty;
+    unordered_map<int, string>::const_iterator i = this->comments.find(node);
+    return (i == this->comments.end()) ? empty : i->second;
+}
@@ -0,0 +1,164 @@
+// ==========================================
+// File:    VariationTree.hpp
+// Author:  Juan Carlos Farah
+// Email:   juancarlos.farah14@imperial.ac.uk
+// ==========================================
+
+#ifndef VARIATION_TREE_HPP
+#define VARIATION_TREE_HPP
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+using namespace std;
+
+#include "Settings.hpp"
+#include "Position.hpp"
+#include "Move.hpp"
+
+// Constants: Variation Tree Nodes
+// ===============================
+// NO_NODE stands for a missing node, e.g. the parent of the root, and
+// NO_SCORE for a node that has not been given a score.
+const int NO_NODE = -1;
+const int NO_SCORE = INT16_MIN;
+
+// Struct: VariationNode
+// =====================
+// A node of a VariationTree. It holds only the move that leads to it
+// from its parent, what that move captured so that it can be taken
+// back, and a glyph and a score annotating it. Its children are linked
+// through their siblings, and every node reaching the same position
+// is linked into a ring through its transposition.
+struct VariationNode {
+    Move move;              // Move from the parent.
+    Piece captured;         // Piece the move captured, if any.
+    uint8_t glyph;          // Numeric annotation glyph, 0 for none.
+    int16_t score;          // Score in centipawns, or NO_SCORE.
+    uint16_t depth;         // Moves from the root.
+    int32_t parent;         // Node the move is played from.
+    int32_t firstChild;     // First move played from here.
+    int32_t nextSibling;    // Next move played from the parent.
+    int32_t transposition;  // Next node reaching the same position.
+};
+
+// Class: VariationTree
+// ===================
+// This class holds the tree of variations of an analysis, e.g. a
+// study, starting from a Position. Analysts may branch off from any
+// node, so the moves are stored as a tree of VariationNode objects,
+// each of which only holds a move and its annotations, while the lines
+// share the moves they have in common. The Position at the current node
+// is kept, and going to another node takes back the moves down to the
+// node they have in common and plays those to the other node. If that
+// is further than the nearest snapshot above the other node, which is
+// kept every VARIATION_SNAPSHOT_PLIES moves, it is played from there
+// instead. Nodes reaching the same position, even through different
+// moves, are found through the hash of the position.
+class VariationTree {
+
+    private:
+
+        vector<VariationNode> nodes;    // Every node, the root first.
+        Position position;              // Position at the current node.
+        int current;                    // Current node.
+
+        // The Position at every node VARIATION_SNAPSHOT_PLIES moves
+        // deep, by node, and the first node reaching each position,
+        // by hash. Comments are kept apart as few nodes have one.
+        unordered_map<int, Position> snapshots;
+        unordered_map<Key, int> firstByKey;
+        unordered_map<int, string> comments;
+
+        // The nodes on the way down to a node, reused by goTo.
+        vector<int> path;
+
+        // Method: walkDown
+        // ================
+        // Plays the moves of the nodes in path on the Position,
+        // the last one in path first.
+        void walkDown();
+
+        // Method: stepBack
+        // ================
+        // Takes back the move of the current node on the Position
+        // and makes its parent the current node.
+        void stepBack();
+
+    public:
+
+        // Constructor:
+        // ============
+        // Takes the Position the analysis starts from, which is copied
+        // and is the Position at the root of the tree.
+        VariationTree(const Position& start);
+
+        // Method: addMove
+        // ===============
+        // Takes a Move and plays it from the current node, adding a
+        // child for it unless there is one already, and makes the child
+        // the current node. Returns the child, or NO_NODE, leaving the
+        // current node as is, if the Move is not legal.
+        int addMove(Move move);
+
+        // Method: goTo
+        // ============
+        // Takes a node and makes it the current node, bringing the
+        // Position to it. Returns false if there is no such node.
+        bool goTo(int node);
+
+        // Method: getCurrent
+        // ==================
+        // Returns the current node.
+        int getCurrent() const;
+
+        // Method: getPosition
+        // ===================
+        // Returns the Position at the current node.
+        const Position& getPosition() const;
+
+        // Method: getNode
+        // ===============
+        // Returns the VariationNode of the given node, e.g. to walk
+        // the tree through its links.
+        const VariationNode& getNode(int node) const;
+
+        // Method: getSize
+        // ===============
+        // Returns the number of nodes, counting the root.
+        int getSize() const;
+
+        // Method: findNode
+        // ================
+        // Takes the hash of a position and returns the first node added
+        // that reaches it, or NO_NODE. The others reaching it follow
+        // through the transposition of each node.
+        int findNode(Key key) const;
+
+        // Method: setGlyph
+        // ================
+        // Takes a node and a numeric annotation glyph, e.g. 1 for a
+        // good move, and annotates the node with it, or clears it if 0.
+        void setGlyph(int node, uint8_t glyph);
+
+        // Method: setScore
+        // ================
+        // Takes a node and a score in centipawns and annotates the
+        // node with it. NO_SCORE clears it.
+        void setScore(int node, int score);
+
+        // Method: setComment
+        // ==================
+        // Takes a node and a comment and annotates the node with
+        // it, or clears it if the comment is empty.
+        void setComment(int node, const string& comment);
+
+        // Method: getComment
+        // ==================
+        // Returns the comment of the given node, which is
+        // empty if it has none.
+        const string& getComment(int node) const;
+};
+
+#endif